@@ -0,0 +1,103 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Benchmark of block sparse dense against dense execution on CPU.
+
+Builds a single ``nn.dense`` layer, converts it to ``nn.sparse_dense`` with
+``relay.data_dep_optimization.bsr_dense.convert`` for a range of weight sparsity levels and
+reports the speedup over the dense layer. The block size of the sparse weight is selected
+automatically from its sparsity pattern unless ``--block-size`` is given.
+"""
+import argparse
+
+import numpy as np
+
+import tvm
+from tvm import relay
+from tvm.contrib import graph_executor
+from tvm.relay.analysis.sparse_dense import select_block_size
+
+
+def random_weight(rows, cols, block_size, sparsity):
+    """Random weight where whole ``block_size`` blocks are zero with probability ``sparsity``."""
+    bs_r, bs_c = block_size
+    mask = np.random.rand(rows // bs_r, cols // bs_c) >= sparsity
+    mask = np.repeat(np.repeat(mask, bs_r, axis=0), bs_c, axis=1)
+    return (np.random.randn(rows, cols) * mask).astype("float32")
+
+
+def measure(func, params, x_np, target, args):
+    with tvm.transform.PassContext(opt_level=3):
+        lib = relay.build(func, target, params=params)
+    dev = tvm.cpu()
+    module = graph_executor.GraphModule(lib["default"](dev))
+    module.set_input("data", x_np)
+    return module.benchmark(dev, number=args.number, repeat=args.repeat).median
+
+
+def main(args):
+    target = tvm.target.Target(args.target)
+    data = relay.var("data", shape=(args.batch, args.in_features), dtype="float32")
+    weight = relay.var("weight", shape=(args.out_features, args.in_features), dtype="float32")
+    func = relay.Function([data, weight], relay.nn.dense(data, weight))
+    x_np = np.random.randn(args.batch, args.in_features).astype("float32")
+    pattern = tuple(args.pattern)
+    block_size = tuple(args.block_size) if args.block_size else "auto"
+
+    header = ("sparsity", "blocks", "dense (ms)", "sparse (ms)", "speedup")
+    print("%-10s %-10s %-12s %-12s %-8s" % header)
+    for sparsity in args.sparsity:
+        w_np = random_weight(args.out_features, args.in_features, pattern, sparsity)
+        dense_time = measure(func, {"weight": tvm.nd.array(w_np)}, x_np, target, args)
+        sparse_func, params = relay.data_dep_optimization.bsr_dense.convert(
+            func, {"weight": tvm.nd.array(w_np)}, block_size, sparsity_threshold=0.0
+        )
+        sparse_time = measure(sparse_func, params, x_np, target, args)
+        chosen = select_block_size(w_np) if block_size == "auto" else block_size
+        print(
+            "%-10.2f %-10s %-12.3f %-12.3f %-8.2f"
+            % (
+                sparsity,
+                "x".join(map(str, chosen)),
+                dense_time * 1e3,
+                sparse_time * 1e3,
+                dense_time / sparse_time,
+            )
+        )
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--target", type=str, default="llvm")
+    parser.add_argument("--batch", type=int, default=16)
+    parser.add_argument("--in-features", type=int, default=1024)
+    parser.add_argument("--out-features", type=int, default=1024)
+    parser.add_argument(
+        "--sparsity", type=float, nargs="+", default=[0.5, 0.7, 0.8, 0.9, 0.95, 0.99]
+    )
+    parser.add_argument(
+        "--pattern",
+        type=int,
+        nargs=2,
+        default=[16, 1],
+        help="block structure of the generated weights, 1 1 for unstructured sparsity",
+    )
+    parser.add_argument(
+        "--block-size", type=int, nargs=2, default=None, help="BSR block size, auto if unset"
+    )
+    parser.add_argument("--number", type=int, default=10)
+    parser.add_argument("--repeat", type=int, default=5)
+    main(parser.parse_args())
@@ -0,0 +1,92 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Microbenchmark of the Relay VM interpreter overhead.
+
+Runs a scalar while loop, where every iteration is a handful of tiny kernels plus control
+flow, so the measured time is dominated by instruction dispatch rather than by compute.
+The per-iteration cost is derived from two runs with different trip counts, which cancels
+the fixed invocation overhead. Compare the numbers across builds, e.g. with and without
+``-DTVM_VM_DISABLE_THREADED_DISPATCH``.
+"""
+import argparse
+import re
+
+import numpy as np
+
+import tvm
+from tvm import relay
+from tvm.relay.loops import while_loop
+from tvm.runtime import vm as vm_rt
+
+
+def build_loop():
+    """Build ``while i < n: i, s = i + 1, s + i`` over int32 scalars."""
+    i = relay.var("i", shape=(), dtype="int32")
+    s = relay.var("s", shape=(), dtype="int32")
+    n = relay.var("n", shape=(), dtype="int32")
+
+    def cond(i, _):
+        return i < n
+
+    def body(i, s):
+        return [i + relay.const(1, "int32"), s + i]
+
+    loop = while_loop(cond, [i, s], body)
+    out = relay.TupleGetItem(loop(relay.const(0, "int32"), relay.const(0, "int32")), 1)
+    mod = tvm.IRModule.from_expr(relay.Function([n], out))
+    return relay.vm.compile(mod, target="llvm")
+
+
+def loop_instruction_count(exe):
+    """Instruction count of the loop function, i.e. roughly the instructions per iteration."""
+    counts = {}
+    name = None
+    for line in exe.bytecode.splitlines():
+        header = re.match(r"VM Function\[\d+\]: (\S+)\(", line)
+        if header:
+            name = header.group(1)
+        count = re.match(r"# instruction count = (\d+)", line)
+        if count and name != "main":
+            counts[name] = int(count.group(1))
+    return max(counts.values())
+
+
+def main(args):
+    exe = build_loop()
+    dev = tvm.cpu()
+    vm = vm_rt.VirtualMachine(exe, dev)
+
+    def measure(trip_count):
+        n = tvm.nd.array(np.array(trip_count, dtype="int32"), dev)
+        res = vm.benchmark(dev, n, number=args.number, repeat=args.repeat)
+        return res.median
+
+    short_time = measure(args.iterations // 10)
+    long_time = measure(args.iterations)
+    per_iteration = (long_time - short_time) / (args.iterations - args.iterations // 10)
+    instrs = loop_instruction_count(exe)
+    print("instructions per iteration (approx.): %d" % instrs)
+    print("time per iteration:                   %.1f ns" % (per_iteration * 1e9))
+    print("time per instruction:                 %.1f ns" % (per_iteration * 1e9 / instrs))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--iterations", type=int, default=100000)
+    parser.add_argument("--number", type=int, default=3)
+    parser.add_argument("--repeat", type=int, default=5)
+    main(parser.parse_args())
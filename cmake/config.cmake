@@ -336,6 +336,10 @@ set(USE_PT_TVMDSOOP OFF)
 # Whether to use STL's std::unordered_map or TVM's POD compatible Map
 set(USE_FALLBACK_STL_MAP OFF)
 
+# Whether to count object allocations for the pass profiling instrument.
+# Adds a thread local increment to every object allocation.
+set(USE_OBJECT_ALLOCATION_COUNT OFF)
+
 # Whether to enable Hexagon support
 set(USE_HEXAGON OFF)
 set(USE_HEXAGON_SDK /path/to/sdk)
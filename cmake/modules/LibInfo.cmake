@@ -100,6 +100,7 @@ function(add_lib_info src_file)
     TVM_INFO_USE_MKL="${USE_MKL}"
     TVM_INFO_USE_MSVC_MT="${USE_MSVC_MT}"
     TVM_INFO_USE_NNPACK="${USE_NNPACK}"
+    TVM_INFO_USE_OBJECT_ALLOCATION_COUNT="${USE_OBJECT_ALLOCATION_COUNT}"
     TVM_INFO_USE_OPENCL="${USE_OPENCL}"
     TVM_INFO_USE_OPENCL_ENABLE_HOST_PTR="${USE_OPENCL_ENABLE_HOST_PTR}"
     TVM_INFO_USE_OPENCL_GTEST="${USE_OPENCL_GTEST}"
@@ -494,6 +494,83 @@ class TransitiveComparisonAnalyzer {
   std::unique_ptr<Impl> impl_;
 };
 
+/*!
+ * \brief Memoization of Analyzer::Simplify.
+ *
+ * Results are keyed by the structure of the expression, the number of
+ * simplification steps and the enabled rewrite extensions.  Each
+ * ConstraintContext scope gets its own table which is dropped when the
+ * scope exits, and binding a variable through the Analyzer clears all
+ * tables, so that a memoized result is always the one a fresh
+ * simplification would produce.
+ *
+ * \note Updates made directly through a sub-analyzer bypass the
+ *  Analyzer, call Clear() afterwards.
+ */
+class SimplifyCache {
+ public:
+  /*! \brief The default maximum number of entries of a scope's table. */
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  /*! \brief Drop all memoized results. */
+  TVM_DLL void Clear();
+
+  /*!
+   * \brief Set the maximum number of entries of a scope's table.
+   * \param capacity The new capacity, 0 disables memoization.
+   */
+  TVM_DLL void SetCapacity(size_t capacity);
+
+  /*! \brief Number of simplifications answered from the cache. */
+  TVM_DLL int64_t hits() const;
+
+  /*! \brief Number of memoizable simplifications which had to be computed. */
+  TVM_DLL int64_t misses() const;
+
+  /*! \brief Reset the hit and miss counters. */
+  TVM_DLL void ResetStatsCounters();
+
+ private:
+  friend class Analyzer;
+  friend class ConstraintContext;
+  SimplifyCache();
+  TVM_DLL ~SimplifyCache();
+  /*!
+   * \brief Look up the memoized simplification of expr.
+   * \param expr The expression to be simplified.
+   * \param steps The number of simplification steps.
+   * \param extensions The enabled RewriteSimplifier extensions.
+   * \param hash Output, the hash of the key for use in Insert.
+   * \return The memoized result, if any.
+   */
+  Optional<PrimExpr> Lookup(const PrimExpr& expr, int steps, int extensions, size_t* hash);
+  /*!
+   * \brief Memoize the simplification of expr.
+   * \param expr The expression that was simplified.
+   * \param steps The number of simplification steps.
+   * \param extensions The enabled RewriteSimplifier extensions.
+   * \param hash The hash computed by the preceding Lookup.
+   * \param result The simplified expression.
+   */
+  void Insert(const PrimExpr& expr, int steps, int extensions, size_t hash,
+              const PrimExpr& result);
+  /*!
+   * \brief Bypass the cache until the next EnterConstraint, while the
+   *  sub-analyzers are entering a constraint.
+   */
+  void Suspend();
+  /*!
+   * \brief Open a new scope for a constraint and resume memoization.
+   * \param constraint A constraint expression.
+   *
+   * \return an exit function that must be called to close the scope.
+   */
+  std::function<void()> EnterConstraint(const PrimExpr& constraint);
+  class Impl;
+  /*! \brief Internal impl */
+  std::unique_ptr<Impl> impl_;
+};
+
 /*!
  * \brief Constraint context.
  *
@@ -616,6 +693,8 @@ class TVM_DLL Analyzer {
   IntSetAnalyzer int_set;
   /*! \brief sub-analyzer transitive comparisons */
   TransitiveComparisonAnalyzer transitive_comparisons;
+  /*! \brief memoization of Simplify */
+  SimplifyCache simplify_cache;
   /*! \brief constructor */
   Analyzer();
   /*!
@@ -748,6 +827,7 @@ class TVM_DLL Analyzer {
    * \return The result.
    *
    * \note Analyzer will call into sub-analyzers to get the result.
+   *  Results are memoized in simplify_cache.
    */
   PrimExpr Simplify(const PrimExpr& expr, int steps = 2);
 };
@@ -38,6 +38,9 @@
 #include <tvm/runtime/c_runtime_api.h>
 #include <tvm/te/schedule.h>
 
+#include <list>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -165,6 +168,52 @@ class AccessAnalyzer : public ObjectRef {
   TVM_DEFINE_OBJECT_REF_METHODS(AccessAnalyzer, ObjectRef, AccessAnalyzerNode);
 };
 
+/*!
+ * \brief A bounded, thread-safe LRU cache of the inferred iterator ranges, keyed by the
+ * serialized transform steps of a state.
+ * The search policy repeatedly calls ComputeDAG::InferBound on states that share the same
+ * steps (e.g. the survivors of each evolutionary generation), so the replay and the whole-graph
+ * bound inference are only done once per distinct step sequence.
+ * Only the ranges are cached: the ops of the stages are created while replaying the steps
+ * (e.g. by cache_read or rfactor), so each hit rebuilds the stages from the ops and iterators
+ * of the state being bounded.
+ * \note Copying yields an empty cache, since a copied ComputeDAGNode is about to be modified.
+ */
+class InferBoundCache {
+ public:
+  /*! \brief The maximum number of cached step sequences. */
+  static constexpr size_t kCapacity = 4096;
+
+  InferBoundCache() = default;
+  InferBoundCache(const InferBoundCache&) {}
+  InferBoundCache& operator=(const InferBoundCache&) {
+    Clear();
+    return *this;
+  }
+
+  /*!
+   * \brief Look up the iterator ranges of a step sequence.
+   * \param key The serialized transform steps.
+   * \param ranges The output ranges of the iterators of each stage, empty for inlined stages.
+   * \return Whether the key is found.
+   */
+  bool Get(const std::string& key, Array<Array<Range>>* ranges);
+  /*!
+   * \brief Insert the iterator ranges of a step sequence, evicting the least recently used one.
+   * \param key The serialized transform steps.
+   * \param ranges The ranges of the iterators of each stage, empty for inlined stages.
+   */
+  void Put(const std::string& key, const Array<Array<Range>>& ranges);
+  /*! \brief Drop all the cached entries. */
+  void Clear();
+
+ private:
+  using Entry = std::pair<std::string, Array<Array<Range>>>;
+  std::mutex mutex_;
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+
 /*! \brief The auto-scheduler's computational graph and related program analyses. */
 class ComputeDAGNode : public Object {
  public:
@@ -181,6 +230,8 @@ class ComputeDAGNode : public Object {
   State init_state;
   /*! \brief The static read-write access analyzer. */
   AccessAnalyzer access_analyzer;
+  /*! \brief The memoized results of InferBound, not visited. */
+  mutable InferBoundCache infer_bound_cache;
 
   void VisitAttrs(tvm::AttrVisitor* v) {
     v->Visit("tensors", &tensors);
@@ -136,6 +136,20 @@ class Builder : public runtime::ObjectRef {
    * \return The Builder created.
    */
   static Builder PyBuilder(BuilderNode::FBuild f_build);
+  /*!
+   * \brief Create a builder that dispatches the builds to a pool of worker daemons started by
+   * `python -m tvm.exec.meta_schedule_worker`. Identical modules are built only once as long as
+   * the artifact still exists.
+   * \param workers The addresses of the workers in the form of "host:port". Repeat an address to
+   * open multiple connections to the same daemon.
+   * \param timeout_sec The timeout of each build in seconds.
+   * \param heartbeat_timeout_sec The time without heartbeat after which a worker is considered
+   * dead.
+   * \param max_retries The maximal number of times a build is re-dispatched after worker failures.
+   * \return The Builder created.
+   */
+  TVM_DLL static Builder WorkerPoolBuilder(Array<String> workers, double timeout_sec,
+                                           double heartbeat_timeout_sec, int max_retries);
   TVM_DEFINE_MUTABLE_NOTNULLABLE_OBJECT_REF_METHODS(Builder, runtime::ObjectRef, BuilderNode);
 };
 
@@ -206,6 +206,26 @@ class Runner : public runtime::ObjectRef {
    * \return The runner created.
    */
   TVM_DLL static Runner PyRunner(FRun f_run);
+  /*!
+   * \brief Create a runner that dispatches the measurements to a pool of worker daemons started
+   * by `python -m tvm.exec.meta_schedule_worker`. The artifacts are loaded by their paths, so the
+   * workers need to share the file system with the builder.
+   * \param workers The addresses of the workers in the form of "host:port".
+   * \param number The number of times to run the function for taking average.
+   * \param repeat The number of times to repeat the measurement.
+   * \param min_repeat_ms The minimum duration of one `repeat` in milliseconds.
+   * \param enable_cpu_cache_flush Whether to flush the cache on CPU.
+   * \param timeout_sec The timeout of each measurement in seconds.
+   * \param heartbeat_timeout_sec The time without heartbeat after which a worker is considered
+   * dead.
+   * \param max_retries The maximal number of times a measurement is re-dispatched after worker
+   * failures.
+   * \return The runner created.
+   */
+  TVM_DLL static Runner WorkerPoolRunner(Array<String> workers, int number, int repeat,
+                                         int min_repeat_ms, bool enable_cpu_cache_flush,
+                                         double timeout_sec, double heartbeat_timeout_sec,
+                                         int max_retries);
   TVM_DEFINE_MUTABLE_NOTNULLABLE_OBJECT_REF_METHODS(Runner, runtime::ObjectRef, RunnerNode);
 };
 
@@ -225,6 +225,22 @@ class ScheduleRule : public runtime::ObjectRef {
       String structure, Integer vector_length_in_bits, Optional<Integer> max_innermost_factor,
       Optional<Map<String, ObjectRef>> reuse_read, Optional<Map<String, ObjectRef>> reuse_write);
 
+  /*!
+   * \brief Extension of MultiLevelTiling for CPU that software-pipelines the read caches with
+   * the compute, so that the copies of the next tile overlap with the compute on the current one.
+   * \param structure The tiling structure. 'SSRSRS' is recommended.
+   * \param max_innermost_factor The maximum size of the innermost factor. NullOpt means no limit
+   * \param reuse_read Data reuse configuration for reading. NullOpt means no reuse.
+   * \param reuse_write Data reuse configuration for writing. NullOpt means no reuse.
+   * \param prefetch_distances The candidate distances, in tiles, at which the source regions of
+   * the read caches are prefetched. 0 means no prefetching.
+   * \return The schedule rule created
+   */
+  TVM_DLL static ScheduleRule MultiLevelTilingCPUPipeline(
+      String structure, Optional<Integer> max_innermost_factor,
+      Optional<Map<String, ObjectRef>> reuse_read, Optional<Map<String, ObjectRef>> reuse_write,
+      Array<Integer> prefetch_distances);
+
   /*!
    * \brief Create a rule: add-rfactor to some blocks if needed
    * \param max_jobs_per_core The maximum number of jobs to be launched per CPU core. It sets the
@@ -264,6 +280,15 @@ class ScheduleRule : public runtime::ObjectRef {
                                                          int max_vectorize_extent,         //
                                                          Array<Integer> unroll_max_steps,  //
                                                          bool unroll_explicit);
+  /*!
+   * \brief Mark the root block with a software prefetch distance, sampled from the given
+   * candidates. The distance is used by tir.transform.InjectSoftwarePrefetch to prefetch the
+   * strided and indirect loads of innermost loops.
+   * \param prefetch_distances The candidates of the number of iterations to prefetch ahead,
+   * where 0 disables prefetching.
+   * \return The schedule rule created
+   */
+  TVM_DLL static ScheduleRule SoftwarePrefetch(Array<Integer> prefetch_distances);
   /*!
    * \brief Auto bind loops around the block to BlockIdx and ThreadIdx
    * \param max_threadblocks The maximum number of threadblock on GPU
@@ -290,7 +315,7 @@ class ScheduleRule : public runtime::ObjectRef {
 
   /*! \brief Create default schedule rules for LLVM */
   TVM_DLL static Array<ScheduleRule, void> DefaultLLVM();
-  /*! \brief Create default schedule rules for x86 (AVX512 and VNNI) */
+  /*! \brief Create default schedule rules for x86 (AVX512, VNNI, AVX-VNNI and AMX) */
   TVM_DLL static Array<ScheduleRule, void> DefaultX86(const String& type);
   /*! \brief Create default schedule rules for CUDA */
   TVM_DLL static Array<ScheduleRule, void> DefaultCUDA();
@@ -163,6 +163,13 @@ class TaskSchedulerNode : public runtime::Object {
    * \return The results from the runner.
    */
   virtual Array<RunnerResult> JoinRunningTask(int task_id);
+  /*!
+   * \brief Generate the next batch of measure candidates of a task.
+   * \param task_id The task id.
+   * \return The measure candidates; NullOpt if the task has nothing left to measure.
+   * \note The default implementation asks the search strategy of the task.
+   */
+  virtual Optional<Array<MeasureCandidate>> GenerateMeasureCandidates(int task_id);
   /*!
    * \brief Jointly tune a given list of tasks.
    * \param tasks The tasks to be tuned
@@ -277,6 +284,23 @@ class TaskScheduler : public runtime::ObjectRef {
    */
   TVM_DLL static TaskScheduler GradientBased(PackedFunc logger, double alpha, int window_size,
                                              support::LinearCongruentialEngine::TRandState seed);
+  /*!
+   * \brief Create a gradient based task scheduler that stops converged tasks early and
+   * warm-starts new tasks from the nearest tuned workloads in the database.
+   * \param logger The tuning task's logging function.
+   * \param alpha The parameter alpha to control gradient computation.
+   * \param window_size The parameter to control backward window size.
+   * \param patience The number of rounds without enough improvement before a task is stopped.
+   * \param min_improvement The minimal relative improvement of the best latency within
+   * `patience` rounds for a task to be considered as not converged.
+   * \param warm_start_top_k The number of nearest tuned workloads whose best traces are
+   * transplanted to a new task as its first trials. 0 disables warm start.
+   * \param seed The random seed.
+   * \return The task scheduler created.
+   */
+  TVM_DLL static TaskScheduler ConvergenceAware(
+      PackedFunc logger, double alpha, int window_size, int patience, double min_improvement,
+      int warm_start_top_k, support::LinearCongruentialEngine::TRandState seed);
   /*!
    * \brief Create a task scheduler with customized methods on the python-side.
    * \param logger The tuning task's logging function.
@@ -139,6 +139,22 @@ TVM_DLL Pass FoldConstant(bool fold_qnn = false);
  */
 TVM_DLL Pass SplitArgs(uint64_t max_function_args);
 
+/*!
+ * \brief Add static-shape specializations of a function with dynamically shaped parameters.
+ *
+ * Every bucket maps parameter names to static shapes. For each bucket, a copy of the function
+ * in which those parameters have the static shapes is added to the module, so that its kernels
+ * are compiled for static shapes. The original function dispatches to the first copy whose
+ * shapes match the runtime shapes of its arguments, and runs its generic body otherwise.
+ *
+ * \param buckets The shape buckets, in the order they are checked at runtime.
+ * \param func_name The name of the global function to specialize.
+ *
+ * \return The pass.
+ */
+TVM_DLL Pass SpecializeShapeBuckets(Array<Map<String, Array<Integer>>> buckets,
+                                    String func_name = "main");
+
 /*!
  * \brief Fuse operations into expr into separate functions.
  *
@@ -145,6 +145,21 @@ typedef int (*FTVMParallelLambda)(int task_id, TVMParallelGroupEnv* penv, void*
  */
 TVM_DLL int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, int num_task);
 
+/*!
+ * \brief Backend function for running independent tasks concurrently.
+ *
+ *  Unlike TVMBackendParallelLaunch, each task runs single-threaded: its
+ *  env->num_task is 1 and any parallel job it launches runs inline on the
+ *  calling thread. This allows tasks which themselves contain parallel loops.
+ *
+ * \param flambda The task function, called once for each task id in [0, num_task).
+ * \param cdata The closure data.
+ * \param num_task Number of tasks to run.
+ *
+ * \return 0 when no error is thrown, -1 when failure happens
+ */
+TVM_DLL int TVMBackendParallelDispatch(FTVMParallelLambda flambda, void* cdata, int num_task);
+
 /*!
  * \brief BSP barrrier between parallel threads
  * \param task_id the task id of the function.
@@ -29,6 +29,10 @@
 #include <type_traits>
 #include <utility>
 
+#ifndef TVM_OBJECT_ALLOCATION_COUNT
+#define TVM_OBJECT_ALLOCATION_COUNT 0
+#endif
+
 namespace tvm {
 namespace runtime {
 /*!
@@ -40,6 +44,15 @@ namespace runtime {
 template <typename T, typename... Args>
 inline ObjectPtr<T> make_object(Args&&... args);
 
+namespace detail {
+/*!
+ * \brief The number of objects allocated through the object allocators by the calling thread.
+ * \note Used by compile-time profiling to attribute allocations to passes. The allocators only
+ *  count when TVM_OBJECT_ALLOCATION_COUNT is set, e.g. with USE_OBJECT_ALLOCATION_COUNT=ON.
+ */
+TVM_DLL uint64_t& ThreadLocalObjectAllocationCount();
+}  // namespace detail
+
 // Detail implementations after this
 //
 // The current design allows swapping the
@@ -70,6 +83,9 @@ class ObjAllocatorBase {
     using Handler = typename Derived::template Handler<T>;
     static_assert(std::is_base_of<Object, T>::value, "make can only be used to create Object");
     T* ptr = Handler::New(static_cast<Derived*>(this), std::forward<Args>(args)...);
+#if TVM_OBJECT_ALLOCATION_COUNT
+    ++detail::ThreadLocalObjectAllocationCount();
+#endif
     ptr->type_index_ = T::RuntimeTypeIndex();
     ptr->deleter_ = Handler::Deleter();
     return ObjectPtr<T>(ptr);
@@ -89,6 +105,9 @@ class ObjAllocatorBase {
                   "make_inplace_array can only be used to create Object");
     ArrayType* ptr =
         Handler::New(static_cast<Derived*>(this), num_elems, std::forward<Args>(args)...);
+#if TVM_OBJECT_ALLOCATION_COUNT
+    ++detail::ThreadLocalObjectAllocationCount();
+#endif
     ptr->type_index_ = ArrayType::RuntimeTypeIndex();
     ptr->deleter_ = Handler::Deleter();
     return ObjectPtr<ArrayType>(ptr);
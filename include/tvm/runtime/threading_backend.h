@@ -146,6 +146,13 @@ TVM_DLL void Configure(tvm::runtime::threading::ThreadGroup::AffinityMode mode,
  */
 int32_t NumThreads();
 
+/*!
+ * \brief Whether the calling thread runs a task of a parallel job, i.e. it is a worker
+ *  of the thread pool or runs a task of TVMBackendParallelDispatch.
+ * \return true if parallel jobs launched by this thread cannot use the thread pool.
+ */
+TVM_DLL bool InParallelTask();
+
 }  // namespace threading
 }  // namespace runtime
 }  // namespace tvm
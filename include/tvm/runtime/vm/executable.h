@@ -43,6 +43,13 @@ namespace vm {
 
 struct VMFunction;
 
+/*!
+ * \brief Primitive attribute marking packed functions whose outputs only depend on the
+ * contents of their (host resident) inputs, e.g. shape functions which only need the input
+ * shapes. The VM memoizes the outputs of such functions.
+ */
+constexpr const char* kMemoizeAttr = "vm_memoize";
+
 /*!
  * \brief The executable emitted by the VM compiler.
  *
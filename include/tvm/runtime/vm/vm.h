@@ -203,7 +203,7 @@ class TVM_DLL VirtualMachine : public runtime::ModuleNode {
    * \param reg The register to read from.
    * \return The read object.
    */
-  ObjectRef ReadRegister(RegName reg) const;
+  const ObjectRef& ReadRegister(RegName reg) const;
 
   /*!
    * \brief Read a VM register and cast it to int32_t
@@ -253,6 +253,19 @@ class TVM_DLL VirtualMachine : public runtime::ModuleNode {
   virtual void InvokePacked(Index packed_index, const PackedFunc& func, Index arg_count,
                             Index output_size, const std::vector<ObjectRef>& args);
 
+  /*!
+   * \brief Invoke a PackedFunction marked with kMemoizeAttr, reusing the outputs of an
+   * earlier invocation with the same input contents when possible.
+   *
+   * \param packed_index The offset of the PackedFunction in all functions.
+   * \param func The PackedFunction to be invoked.
+   * \param arg_count The number of arguments to the PackedFunction.
+   * \param output_size The number of outputs of the PackedFunction.
+   * \param args Arguments to the PackedFunction.
+   */
+  void InvokeMemoizedPacked(Index packed_index, const PackedFunc& func, Index arg_count,
+                            Index output_size, const std::vector<ObjectRef>& args);
+
   /*!
    * \brief Initialize the virtual machine for a set of (physical) devices.
    * \param physical_devices The set of TVM devices.
@@ -329,7 +342,7 @@ class TVM_DLL VirtualMachine : public runtime::ModuleNode {
    *
    * \param instr Instruction that will be executed after this hook fires
    */
-  virtual void OpStartHook(Instruction instr);
+  virtual void OpStartHook(const Instruction& instr);
 
   /*!
    * \brief Internal hook for profiling the end of an op.
@@ -425,6 +438,16 @@ class TVM_DLL VirtualMachine : public runtime::ModuleNode {
  protected:
   /*! \brief The virtual machine's packed function table. */
   std::vector<PackedFunc> packed_funcs_;
+  /*! \brief Whether the outputs of each packed function may be memoized. */
+  std::vector<bool> memoize_packed_;
+  /*!
+   * \brief The memoized outputs of packed functions, per packed index, from the serialized
+   * input contents to the output contents.
+   */
+  std::vector<std::unordered_map<std::string, std::vector<std::string>>> memoized_outputs_;
+  /*! \brief The number of memoized invocations which reused or recorded their outputs. */
+  int64_t memoize_hits_ = 0;
+  int64_t memoize_misses_ = 0;
   /*! \brief The current stack of call frames. */
   std::vector<VMFrame> frames_;
   /*! \brief The fuction table index of the current function. */
@@ -225,6 +225,27 @@ TVM_DLL const Op& call_spirv_pure_glsl450();
  */
 TVM_DLL const Op& prefetch();
 
+/*!
+ * \brief Load a vector from consecutive addresses, reading only the
+ *  lanes enabled by a boolean mask.  Disabled lanes are zero.
+ *
+ *  DType masked_load(DType* addr, bool mask[lanes]) {
+ *    for (int i = 0; i < lanes; ++i) ret[i] = mask[i] ? addr[i] : 0;
+ *    return ret;
+ *  }
+ */
+TVM_DLL const Op& masked_load();
+
+/*!
+ * \brief Store a vector to consecutive addresses, writing only the
+ *  lanes enabled by a boolean mask.
+ *
+ *  void masked_store(DType* addr, DType value, bool mask[lanes]) {
+ *    for (int i = 0; i < lanes; ++i) if (mask[i]) addr[i] = value[i];
+ *  }
+ */
+TVM_DLL const Op& masked_store();
+
 /*!
  * \brief Get head access address with memory access pattern info.
  *
@@ -1437,6 +1437,11 @@ constexpr const char* pragma_tensor_core = "pragma_tensor_core";
  *  run prefetch of Tensor on the current loop scope
  */
 constexpr const char* prefetch_scope = "prefetch_scope";
+/*!
+ * \brief Pragma: the number of iterations ahead that InjectSoftwarePrefetch
+ *  prefetches strided and indirect loads of the innermost loops in its scope.
+ */
+constexpr const char* pragma_software_prefetch = "pragma_software_prefetch";
 /*!
  * \brief Marks the layout transforms to be used for a tensor.
  *
@@ -1504,6 +1509,13 @@ constexpr const char* pipeline_exec_scope = "pipeline_exec_scope";
  */
 constexpr const char* device_scope = "device_scope";
 
+/*!
+ * \brief Mark that the attached statement is run as value (IntImm) independent tasks
+ *  through TVMBackendParallelDispatch. The node is the task id Var bound in the body.
+ *  Each task runs single-threaded, so the body may call kernels with parallel loops.
+ */
+constexpr const char* parallel_dispatch = "parallel_dispatch";
+
 /*!
  * \brief Mark that the attached statement runs asynchronously.
  */
@@ -1571,6 +1583,12 @@ constexpr const char* software_pipeline_order = "software_pipeline_order";
  */
 constexpr const char* software_pipeline_async_stages = "software_pipeline_async_stages";
 
+/*! \brief The number of iterations ahead that the steady state of a software pipeline prefetches
+ *  the inputs of its producer stages. Used on CPU to overlap the copies into local tiles with the
+ *  compute on the previous tile.
+ */
+constexpr const char* software_pipeline_prefetch = "software_pipeline_prefetch";
+
 /*! \brief Mark the buffers which is const access and can be transformed layout. */
 constexpr const char* layout_free_buffers = "layout_free_buffers";
 
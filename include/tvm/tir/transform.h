@@ -65,6 +65,17 @@ TVM_DLL Pass CreatePrimFuncPass(
  */
 TVM_DLL Pass InjectPrefetch();
 
+/*!
+ * \brief Insert software prefetches for the strided and indirect loads of
+ *  innermost loops on CPU targets.
+ *
+ *  The prefetch distance is taken from the "tir.InjectSoftwarePrefetch"
+ *  config, or from an enclosing pragma_software_prefetch attribute.
+ *
+ * \return The pass.
+ */
+TVM_DLL Pass InjectSoftwarePrefetch();
+
 // TODO(tvm-team): consolidate configs to the PassContext
 /*!
  * \brief Flatten the multi-dimensional read/write
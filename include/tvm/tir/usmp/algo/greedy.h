@@ -56,7 +56,7 @@ class GreedyBase {
    * \brief Rounds up the offset to satisfy the alignement requirement
    */
   size_t round_up_to_byte_alignment(const size_t& non_aligned_byte_offset,
-                                    const int& byte_alignment);
+                                    const int& byte_alignment) const;
 
   /*!
    * \brief A helper function check whether a offset is valid given the constraints
@@ -51,6 +51,18 @@ constexpr const char* kUSMPUseWorkspaceIO = "tir.usmp.use_workspace_io";
  * The algorithm should be provided as registered PackedFunc with the name tir.usmp.algorithm.NAME
  */
 constexpr const char* kUSMPCustomAlgorithmOption = "tir.usmp.custom_algorithm";
+/*!
+ * \brief PassContext option to set the number of independent hill climb restarts in USMP.
+ * Restarts use different seeds, may run in parallel and the smallest plan is kept.
+ */
+constexpr const char* kUSMPHillClimbNumRestartsOption = "tir.usmp.hill_climb.num_restarts";
+/*!
+ * \brief PassContext option to bound the wall time (in milliseconds) of the hill climb in USMP.
+ * The budget is a single deadline shared by all restarts, not a budget per restart. Past it, no
+ * restart starts a new attempt beyond its first one, and the best plan found so far is used.
+ * 0 means no limit.
+ */
+constexpr const char* kUSMPHillClimbTimeBudgetOption = "tir.usmp.hill_climb.time_budget_ms";
 
 namespace tir {
 namespace usmp {
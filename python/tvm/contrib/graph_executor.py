@@ -29,8 +29,9 @@ def create(graph_json_str, libmod, device):
 
     Parameters
     ----------
-    graph_json_str : str
-        The graph to be deployed in json format output by json graph.
+    graph_json_str : Union[str, bytes, bytearray]
+        The graph to be deployed in json format output by json graph,
+        or in the compact binary format made by graph_json_to_binary.
         The graph can contain operator(tvm_op) that points to the name
         of PackedFunc in the libmod.
 
@@ -54,7 +55,9 @@ def create(graph_json_str, libmod, device):
     for examples to directly construct a GraphModule from an exported
     relay compiled library.
     """
-    assert isinstance(graph_json_str, string_types)
+    if isinstance(graph_json_str, bytes):
+        graph_json_str = bytearray(graph_json_str)
+    assert isinstance(graph_json_str, string_types + (bytearray,))
 
     dev, num_rpc_dev, device_type_id = get_device(libmod, device)
 
@@ -66,6 +69,26 @@ def create(graph_json_str, libmod, device):
     return GraphModule(fcreate(graph_json_str, libmod, *device_type_id))
 
 
+def graph_json_to_binary(graph_json_str):
+    """Convert a graph JSON to the compact binary graph format.
+
+    The binary graph interns all strings and stores the nodes as flat arrays, so the
+    graph executor loads it without parsing. It can be passed to :py:func:`create`
+    in place of the graph JSON.
+
+    Parameters
+    ----------
+    graph_json_str : str
+        The graph in json format.
+
+    Returns
+    -------
+    graph_binary : bytearray
+        The graph in the binary format.
+    """
+    return tvm._ffi.get_global_func("tvm.graph_executor.graph_json_to_binary")(graph_json_str)
+
+
 def get_device(libmod, device):
     """Parse and validate all the device(s).
 
@@ -210,6 +233,37 @@ class GraphModule(object):
                 if val:
                     self._get_input(k).copyfrom(params[k])
 
+    def set_param(self, key, value):
+        """Set a parameter of the module, which is shared with the clones.
+
+        Unlike writing to the array returned by get_input, as set_input does,
+        this packs the weights again when weight packing is enabled.
+
+        Parameters
+        ----------
+        key : str
+           The name of the parameter
+
+        value : NDArray
+           The parameter value
+        """
+        self.module["set_param"](key, value)
+
+    def enable_weight_packing(self):
+        """Run the nodes computed from parameters only, such as the layout transforms
+        left unfolded by the pass config "relay.FoldConstant.skip_layout_transform",
+        once after the parameters change instead of on every run.
+
+        Parameters set with set_param are packed again automatically. After writing
+        to a parameter in place, e.g. with set_input, call repack_weights.
+        """
+        self.module["enable_weight_packing"]()
+
+    def repack_weights(self):
+        """Pack the weights again before the next run, after a parameter was written
+        in place while weight packing is enabled."""
+        self.module["repack_weights"]()
+
     def set_input_zero_copy(self, key=None, value=None, **params):
         """Set inputs to the module via kwargs with zero memory copy
 
@@ -394,6 +448,21 @@ class GraphModule(object):
         """
         self._share_params(other.module, bytearray(params_bytes))
 
+    def clone(self):
+        """Create a new executor for the same graph, e.g. for another serving thread.
+
+        The graph, the compiled functions and the parameters are shared with this
+        executor, only the storage of the activations and of the packed weights is
+        allocated anew. Setting a parameter on any of the executors changes it for
+        all of them.
+
+        Returns
+        -------
+        graph_module : GraphModule
+            The new executor.
+        """
+        return GraphModule(self.module["clone"]())
+
     def __getitem__(self, key):
         """Get internal module function
 
@@ -0,0 +1,160 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Start a worker daemon serving the build and run jobs of meta schedule's
+WorkerPoolBuilder and WorkerPoolRunner.
+
+Each connection is served by a forked process, so a crash in one job does not affect the others.
+The protocol is a sequence of frames, each being a 4-byte little-endian length followed by the
+bytes. A request is the job kind ("build" or "run") followed by its payload. While working, the
+worker sends a "heartbeat" frame periodically, and it finishes the job with an "ok" or "error"
+frame followed by the result or the error message. Closing the connection kills the job in
+progress, since the next heartbeat fails and the forked process exits.
+"""
+import argparse
+import logging
+import socketserver
+import struct
+import threading
+import traceback
+
+import tvm
+from tvm.meta_schedule.builder.local_builder import default_build, default_export
+from tvm.meta_schedule.runner.config import EvaluatorConfig
+from tvm.meta_schedule.runner.local_runner import default_alloc_argument, default_run_evaluator
+
+
+def _recv_bytes(sock):
+    def _recv_exact(size):
+        data = b""
+        while len(data) < size:
+            chunk = sock.recv(size - len(data))
+            if not chunk:
+                return None
+            data += chunk
+        return data
+
+    header = _recv_exact(4)
+    if header is None:
+        return None
+    return _recv_exact(struct.unpack("<i", header)[0])
+
+
+def _send_bytes(sock, data):
+    sock.sendall(struct.pack("<i", len(data)) + data)
+
+
+def _to_python(obj):
+    if isinstance(obj, tvm.ir.container.Array):
+        return [_to_python(x) for x in obj]
+    if isinstance(obj, tvm.tir.IntImm):
+        return obj.value
+    if isinstance(obj, tvm.runtime.container.String):
+        return str(obj)
+    return obj
+
+
+def _build(payload):
+    mod, target = tvm.ir.load_json(payload)
+    rt_mod = default_build(mod, tvm.target.Target(str(target)), None)
+    return default_export(rt_mod)
+
+
+def _run(payload):
+    artifact_path, device_type, args_info, config = _to_python(tvm.ir.load_json(payload))
+    number, repeat, min_repeat_ms, enable_cpu_cache_flush = config
+    rt_mod = tvm.runtime.load_module(artifact_path)
+    device = tvm.runtime.device(dev_type=device_type, dev_id=0)
+    repeated_args = default_alloc_argument(device, args_info, alloc_repeat=1)
+    evaluator_config = EvaluatorConfig(
+        number=number,
+        repeat=repeat,
+        min_repeat_ms=min_repeat_ms,
+        enable_cpu_cache_flush=bool(enable_cpu_cache_flush),
+    )
+    costs = default_run_evaluator(rt_mod, device, evaluator_config, repeated_args)
+    return ",".join(repr(float(cost)) for cost in costs)
+
+
+_JOBS = {"build": _build, "run": _run}
+
+
+class _Handler(socketserver.BaseRequestHandler):
+    """Serve the jobs sent over one connection in order."""
+
+    def handle(self):
+        while True:
+            kind = _recv_bytes(self.request)
+            payload = _recv_bytes(self.request)
+            if kind is None or payload is None:
+                return
+            result = {}
+
+            def _work(kind=kind.decode(), payload=payload.decode()):
+                # pylint: disable=broad-except
+                try:
+                    result["ok"] = _JOBS[kind](payload)
+                except Exception:
+                    result["error"] = traceback.format_exc()
+
+            thread = threading.Thread(target=_work, daemon=True)
+            thread.start()
+            while True:
+                thread.join(self.server.heartbeat_interval)
+                if not thread.is_alive():
+                    break
+                _send_bytes(self.request, b"heartbeat")
+            status = "ok" if "ok" in result else "error"
+            _send_bytes(self.request, status.encode())
+            _send_bytes(self.request, result[status].encode())
+
+
+_Server = getattr(socketserver, "ForkingTCPServer", socketserver.ThreadingTCPServer)
+
+
+def main(args):
+    """Main function
+
+    Parameters
+    ----------
+    args : argparse.Namespace
+        parsed args from command-line invocation
+    """
+    _Server.allow_reuse_address = True
+    with _Server((args.host, args.port), _Handler) as server:
+        server.heartbeat_interval = args.heartbeat_interval
+        logging.info("meta schedule worker listening on %s:%d", args.host, args.port)
+        server.serve_forever()
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "--host",
+        type=str,
+        default="127.0.0.1",
+        help="The host IP address the worker binds to, use 0.0.0.0 to accept remote builders",
+    )
+    parser.add_argument("--port", type=int, default=9300, help="The port of the worker")
+    parser.add_argument(
+        "--heartbeat-interval",
+        type=float,
+        default=1.0,
+        help="The interval in seconds between two heartbeats sent while working on a job",
+    )
+    args = parser.parse_args()
+    logging.basicConfig(level=logging.INFO)
+    main(args)
@@ -255,3 +255,48 @@ class PassTimingInstrument(tvm.runtime.Object):
                 profiles = timing_inst.render()
         """
         return _ffi_instrument_api.RenderTimePassProfiles()
+
+
+@tvm._ffi.register_object("instrument.PassProfilingInstrument")
+class PassProfilingInstrument(tvm.runtime.Object):
+    """A pass instrument implemented in C++ which profiles every pass, including the ones
+    nested in sequential passes.
+
+    For each pass it records the wall time, the number of objects allocated while the pass ran
+    and, optionally, the number of IR nodes before and after the pass. The time and allocations
+    spent in the instrument itself are excluded. Allocations are only reported when TVM is built
+    with USE_OBJECT_ALLOCATION_COUNT. Results are kept until the instrument enters a new
+    PassContext.
+
+    Parameters
+    ----------
+    count_ir_nodes : bool
+        Whether to count the IR nodes of the module before and after every pass.
+    """
+
+    def __init__(self, count_ir_nodes=True):
+        self.__init_handle_by_constructor__(
+            _ffi_instrument_api.MakePassProfilingInstrument, count_ir_nodes
+        )
+
+    def render(self):
+        """Render the profiles as an indented tree of passes.
+
+        Returns
+        -------
+        report : str
+            One line per pass: total and self time, total and self allocations if counted,
+            IR nodes before and after the pass.
+        """
+        return _ffi_instrument_api.RenderPassProfilingReport(self)
+
+    def chrome_trace(self):
+        """Render the profiles in the Chrome trace event format, viewable in
+        chrome://tracing or Perfetto.
+
+        Returns
+        -------
+        trace : str
+            The JSON trace.
+        """
+        return _ffi_instrument_api.PassProfilingChromeTrace(self)
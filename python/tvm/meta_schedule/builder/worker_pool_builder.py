@@ -0,0 +1,60 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Builder dispatching the builds to a pool of worker daemons"""
+from typing import List
+
+from tvm._ffi import register_object
+
+from .. import _ffi_api
+from .builder import Builder
+
+
+@register_object("meta_schedule.WorkerPoolBuilder")
+class WorkerPoolBuilder(Builder):
+    """Builder that dispatches the builds to a pool of worker daemons started by
+    `python -m tvm.exec.meta_schedule_worker`. Idle workers pull the next build from a shared
+    queue; a build whose worker dies or stops sending heartbeats is re-dispatched to the others.
+    Identical modules are built only once as long as the artifact still exists, and each
+    duplicate gets a copy of the artifact so that removing one build directory keeps the others.
+
+    Parameters
+    ----------
+    workers : List[str]
+        The addresses of the workers in the form of "host:port". Repeat an address to open
+        multiple connections to the same daemon, e.g. once per core of the host.
+    timeout_sec : float
+        The timeout of each build in seconds. A build running longer is killed and fails.
+    heartbeat_timeout_sec : float
+        The time without heartbeat after which a worker is considered dead.
+    max_retries : int
+        The maximal number of times a build is re-dispatched after worker failures.
+    """
+
+    def __init__(
+        self,
+        workers: List[str],
+        timeout_sec: float = 30.0,
+        heartbeat_timeout_sec: float = 10.0,
+        max_retries: int = 2,
+    ) -> None:
+        self.__init_handle_by_constructor__(
+            _ffi_api.BuilderWorkerPoolBuilder,  # type: ignore # pylint: disable=no-member
+            workers,
+            timeout_sec,
+            heartbeat_timeout_sec,
+            max_retries,
+        )
@@ -30,3 +30,4 @@ from .runner import (
     RunnerResult,
     create,
 )
+from .worker_pool_runner import WorkerPoolRunner
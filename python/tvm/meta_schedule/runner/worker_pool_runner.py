@@ -0,0 +1,68 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Runner dispatching the measurements to a pool of worker daemons"""
+from typing import List, Optional
+
+from tvm._ffi import register_object
+
+from .. import _ffi_api
+from .config import EvaluatorConfig
+from .runner import Runner
+
+
+@register_object("meta_schedule.WorkerPoolRunner")
+class WorkerPoolRunner(Runner):
+    """Runner that dispatches the measurements to a pool of worker daemons started by
+    `python -m tvm.exec.meta_schedule_worker`. The artifacts are loaded by their paths, so the
+    workers need to share the file system with the builder.
+
+    Parameters
+    ----------
+    workers : List[str]
+        The addresses of the workers in the form of "host:port". Each connection measures one
+        artifact at a time, so use one connection per device to avoid interference.
+    evaluator_config : Optional[EvaluatorConfig]
+        The evaluator configuration.
+    timeout_sec : float
+        The timeout of each measurement in seconds. A measurement running longer is killed and
+        fails.
+    heartbeat_timeout_sec : float
+        The time without heartbeat after which a worker is considered dead.
+    max_retries : int
+        The maximal number of times a measurement is re-dispatched after worker failures.
+    """
+
+    def __init__(
+        self,
+        workers: List[str],
+        evaluator_config: Optional[EvaluatorConfig] = None,
+        timeout_sec: float = 30.0,
+        heartbeat_timeout_sec: float = 10.0,
+        max_retries: int = 2,
+    ) -> None:
+        config = EvaluatorConfig._normalized(evaluator_config)
+        self.__init_handle_by_constructor__(
+            _ffi_api.RunnerWorkerPoolRunner,  # type: ignore # pylint: disable=no-member
+            workers,
+            config.number,
+            config.repeat,
+            config.min_repeat_ms,
+            config.enable_cpu_cache_flush,
+            timeout_sec,
+            heartbeat_timeout_sec,
+            max_retries,
+        )
@@ -26,6 +26,7 @@ from .auto_inline import AutoInline, InlineConstantScalars
 from .cross_thread_reduction import CrossThreadReduction
 from .multi_level_tiling import (
     MultiLevelTiling,
+    MultiLevelTilingCPUPipeline,
     MultiLevelTilingTensorCore,
     MultiLevelTilingWideVector,
     MultiLevelTilingWithIntrin,
@@ -34,3 +35,4 @@ from .multi_level_tiling import (
 from .parallel_vectorize_unroll import ParallelizeVectorizeUnroll
 from .random_compute_location import RandomComputeLocation
 from .schedule_rule import PyScheduleRule, ScheduleRule
+from .software_prefetch import SoftwarePrefetch
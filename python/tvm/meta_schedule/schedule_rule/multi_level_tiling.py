@@ -232,3 +232,43 @@ class MultiLevelTilingWideVector(ScheduleRule):
             reuse_read.as_dict() if reuse_read is not None else None,
             reuse_write.as_dict() if reuse_write is not None else None,
         )
+
+
+@register_object("meta_schedule.MultiLevelTilingCPUPipeline")
+class MultiLevelTilingCPUPipeline(ScheduleRule):
+    """Extension of MultiLevelTiling for CPU that software-pipelines the read caches with the
+    compute, so that the copies into the read caches of the next tile overlap with the compute on
+    the current one. The source regions of later tiles are optionally prefetched.
+
+    Parameters
+    ----------
+    structure : str
+        The tiling structure. 'SSRSRS' is recommended.
+    max_innermost_factor : Optional[int]
+        The maximum size of the innermost factor. None means no limit
+    reuse_read : Optional[ReuseType]
+        Data reuse configuration for reading. None means no reuse.
+    reuse_write : Optional[ReuseType]
+        Data reuse configuration for writing. None means no reuse.
+    prefetch_distances : Optional[List[int]]
+        The candidate prefetch distances in tiles. 0 means no prefetching.
+    """
+
+    def __init__(
+        self,
+        structure: str,
+        max_innermost_factor: Optional[int] = None,
+        reuse_read: Optional[ReuseType] = None,
+        reuse_write: Optional[ReuseType] = None,
+        prefetch_distances: Optional[List[int]] = None,
+    ) -> None:
+        if prefetch_distances is None:
+            prefetch_distances = [0, 1, 2]
+        self.__init_handle_by_constructor__(
+            _ffi_api.ScheduleRuleMultiLevelTilingCPUPipeline,  # type: ignore # pylint: disable=no-member
+            structure,
+            max_innermost_factor,
+            reuse_read.as_dict() if reuse_read is not None else None,
+            reuse_write.as_dict() if reuse_write is not None else None,
+            prefetch_distances,
+        )
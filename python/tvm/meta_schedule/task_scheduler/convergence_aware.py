@@ -0,0 +1,71 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Convergence Aware Task Scheduler"""
+from tvm._ffi import register_object
+
+from .. import _ffi_api
+from ..logging import get_logger, get_logging_func
+from .task_scheduler import TaskScheduler
+
+logger = get_logger(__name__)  # pylint: disable=invalid-name
+
+
+@register_object("meta_schedule.ConvergenceAware")
+class ConvergenceAware(TaskScheduler):
+    """Gradient based task scheduler that stops converged tasks early and warm-starts new tasks
+    from the nearest tuned workloads in the database."""
+
+    def __init__(
+        self,
+        *,
+        alpha: float = 0.2,
+        window_size: int = 3,
+        patience: int = 4,
+        min_improvement: float = 0.01,
+        warm_start_top_k: int = 2,
+        seed: int = -1,
+    ) -> None:
+        """Constructor.
+
+        Parameters
+        ----------
+        alpha : float = 0.2
+            The parameter alpha in gradient computation.
+        window_size : int = 3
+            The parameter to control backward window size in gradient computation.
+        patience : int = 4
+            The number of rounds without enough improvement before a task is stopped.
+            0 disables the convergence detection.
+        min_improvement : float = 0.01
+            The minimal relative improvement of the best latency within `patience` rounds
+            for a task to keep being tuned.
+        warm_start_top_k : int = 2
+            The number of nearest tuned workloads in the database whose best traces are
+            transplanted to a new task as its first trials. 0 disables warm start.
+        seed : int = -1
+            The random seed.
+        """
+        self.__init_handle_by_constructor__(
+            _ffi_api.TaskSchedulerConvergenceAware,  # type: ignore # pylint: disable=no-member
+            get_logging_func(logger),
+            alpha,
+            window_size,
+            patience,
+            min_improvement,
+            warm_start_top_k,
+            seed,
+        )
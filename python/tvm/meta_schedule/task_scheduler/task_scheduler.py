@@ -63,7 +63,9 @@ class TaskScheduler(Object):
     cost_model_: Optional[CostModel]
     remaining_tasks_: int
 
-    TaskSchedulerType = Union["TaskScheduler", Literal["gradient", "round-robin"]]
+    TaskSchedulerType = Union[
+        "TaskScheduler", Literal["gradient", "round-robin", "convergence-aware"]
+    ]
 
     def next_task_id(self) -> int:
         """Fetch the next task id.
@@ -169,12 +171,13 @@ class TaskScheduler(Object):
 
     @staticmethod
     def create(  # pylint: disable=keyword-arg-before-vararg
-        kind: Literal["round-robin", "gradient"] = "gradient",
+        kind: Literal["round-robin", "gradient", "convergence-aware"] = "gradient",
         *args,
         **kwargs,
     ) -> "TaskScheduler":
         """Create a task scheduler."""
         from . import (  # pylint: disable=import-outside-toplevel
+            ConvergenceAware,
             GradientBased,
             RoundRobin,
         )
@@ -183,6 +186,8 @@ class TaskScheduler(Object):
             return RoundRobin(*args, **kwargs)  # type: ignore
         if kind == "gradient":
             return GradientBased(*args, **kwargs)
+        if kind == "convergence-aware":
+            return ConvergenceAware(*args, **kwargs)
         raise ValueError(f"Unknown TaskScheduler name: {kind}")
 
 
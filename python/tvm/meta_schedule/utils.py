@@ -18,6 +18,7 @@
 import ctypes
 import os
 import shutil
+import tempfile
 from typing import Any, Callable, List, Optional, Union
 
 import numpy as np  # type: ignore
@@ -304,6 +305,13 @@ def remove_build_dir(artifact_path: str) -> None:
     shutil.rmtree(os.path.dirname(artifact_path))
 
 
+@register_func("meta_schedule.copy_build_dir")
+def copy_build_dir(artifact_path: str) -> str:
+    """Copy the artifact into a build directory of its own, and return the path of the copy"""
+    build_dir = tempfile.mkdtemp()
+    return shutil.copy2(artifact_path, build_dir)
+
+
 def _json_de_tvm(obj: Any) -> Any:
     """Unpack a TVM nested container to a JSON object in python.
 
@@ -54,6 +54,48 @@ def _search_dense_op_weight(expr):
     return _ffi_api.search_dense_op_weight(expr)
 
 
+# Block shapes considered when the block size is selected automatically. (1, 1) is plain CSR.
+BSR_BLOCK_SIZE_CANDIDATES = [(1, 1), (4, 1), (8, 1), (16, 1), (1, 4), (4, 4), (8, 4), (16, 4)]
+
+
+def select_block_size(w_np, candidates=None, block_overhead=4):
+    """Select the BSR block shape best suited to the sparsity pattern of a dense weight
+
+    The cost of a BSR product is estimated as the number of stored values, including the
+    zeros padded into partially filled blocks, plus a fixed cost per stored block for
+    loading its column index and setting up the inner loops. Scattered nonzeros favor
+    small blocks (CSR), while structured (e.g. block pruned) weights favor large ones.
+
+    Parameters
+    ----------
+    w_np : numpy.ndarray
+        2-D dense weight
+    candidates : Optional[List[Tuple(int, int)]]
+        Block shapes to consider, defaults to BSR_BLOCK_SIZE_CANDIDATES. Shapes that do not
+        divide the weight shape are skipped.
+    block_overhead : float
+        Cost of one stored block, in units of one stored value
+
+    Returns
+    -------
+    ret : Tuple(int, int)
+        The selected block shape
+    """
+    if candidates is None:
+        candidates = BSR_BLOCK_SIZE_CANDIDATES
+    rows, cols = w_np.shape
+    best, best_cost = (1, 1), None
+    for bs_r, bs_c in candidates:
+        if rows % bs_r != 0 or cols % bs_c != 0:
+            continue
+        blocks = w_np.reshape(rows // bs_r, bs_r, cols // bs_c, bs_c)
+        num_blocks = np.count_nonzero(np.any(blocks != 0, axis=(1, 3)))
+        cost = num_blocks * (bs_r * bs_c + block_overhead)
+        if best_cost is None or cost < best_cost:
+            best, best_cost = (bs_r, bs_c), cost
+    return best
+
+
 def process_params(expr, params, block_size, sparsity_threshold):
     """[summary]
 
@@ -63,8 +105,9 @@ def process_params(expr, params, block_size, sparsity_threshold):
         Expr of the network
     params : Dict[String, tvm.nd.array]
         parameters of the network
-    block_size : Tuple(int, int)
-        Blocksize in BSR matrix
+    block_size : Union[Tuple(int, int), str, None]
+        Blocksize in BSR matrix. If "auto" or None, the block size is selected for every
+        weight from its sparsity pattern, see select_block_size.
     sparsity_threshold : float
         Minimal sparsity requirement for converting to sparse operation
 
@@ -86,7 +129,11 @@ def process_params(expr, params, block_size, sparsity_threshold):
         w_np = params[name].numpy()
         sparsity = 1.0 - (np.count_nonzero(w_np) / w_np.size)
         if sparsity >= sparsity_threshold:
-            sparse_weight = sp.bsr_matrix(w_np, blocksize=block_size)
+            if block_size is None or block_size == "auto":
+                weight_block_size = select_block_size(w_np)
+            else:
+                weight_block_size = block_size
+            sparse_weight = sp.bsr_matrix(w_np, blocksize=weight_block_size)
             # remove dense weight
             del params[name]
             memo.weight_name.append(name)
@@ -102,8 +149,8 @@ def process_params(expr, params, block_size, sparsity_threshold):
             prefix = "sparse_dense_bsr_%d_%d_%d_%d_%d_%d_" % (
                 w_np.shape[0],
                 w_np.shape[1],
-                block_size[0],
-                block_size[1],
+                weight_block_size[0],
+                weight_block_size[1],
                 sparse_weight.indices.shape[0],
                 sparse_weight.indptr.shape[0],
             )
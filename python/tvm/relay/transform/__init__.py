@@ -20,4 +20,5 @@
 from .transform import *
 from .recast import recast
 from . import fake_quantization_to_integer, mixed_precision
+from .mixed_precision_tuning import tune_mixed_precision
 from .flexible_shape import FlexibleShapeDispatch
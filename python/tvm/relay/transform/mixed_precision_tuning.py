@@ -0,0 +1,167 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Measurement-driven selection of the operators converted by ToMixedPrecision."""
+from typing import Any, Dict, List, Optional, Tuple
+
+import numpy as np
+
+import tvm
+from tvm import relay
+from tvm.runtime import NDArray
+
+from . import _ffi_api
+from .transform import InferType, ToMixedPrecision
+
+
+def _random_inputs(func: "relay.Function") -> Optional[List[np.ndarray]]:
+    inputs = []
+    for param in func.params:
+        ttype = param.checked_type
+        if not isinstance(ttype, relay.TensorType):
+            return None
+        shape = [int(dim) for dim in ttype.shape]
+        if "float" in ttype.dtype:
+            inputs.append(np.random.uniform(-1, 1, size=shape).astype(ttype.dtype))
+        else:
+            inputs.append(np.zeros(shape, dtype=ttype.dtype))
+    return inputs
+
+
+def _measure(
+    mod: tvm.IRModule,
+    inputs: List[np.ndarray],
+    target: tvm.target.Target,
+    number: int,
+    repeat: int,
+) -> Tuple[float, List[NDArray]]:
+    # pylint: disable=import-outside-toplevel
+    from tvm.contrib import graph_executor
+
+    with tvm.transform.PassContext(opt_level=3):
+        lib = relay.build(mod, target=target)
+    dev = tvm.device(target.kind.name, 0)
+    module = graph_executor.GraphModule(lib["default"](dev))
+    for i, data in enumerate(inputs):
+        module.set_input(i, data)
+    module.run()
+    outputs = [module.get_output(i).numpy() for i in range(module.get_num_outputs())]
+    timer = module.module.time_evaluator("run", dev, number=number, repeat=repeat)
+    return timer().mean, outputs
+
+
+def _call_keys(func: "relay.Function") -> List[str]:
+    keys = []
+
+    def _visit(node):
+        if isinstance(node, relay.Call) and isinstance(node.op, tvm.ir.Op):
+            keys.append(_ffi_api.MixedPrecisionCallKey(node))
+
+    relay.analysis.post_order_visit(func, _visit)
+    return keys
+
+
+def tune_mixed_precision(
+    mod: tvm.IRModule,
+    mixed_precision_type: str = "float16",
+    target: str = "llvm",
+    rtol: float = 1e-2,
+    atol: float = 1e-2,
+    number: int = 10,
+    repeat: int = 3,
+    missing_op_mode: int = 2,
+) -> Tuple[tvm.IRModule, List[Dict[str, Any]]]:
+    """Convert a module to mixed precision, keeping in float32 the fused functions which are
+    measured to be slower, or not accurate enough, in mixed precision on the local machine.
+
+    Every fused function of the module is built and run both in float32 and in mixed precision,
+    with random inputs. The mixed precision version keeps the float32 inputs and outputs of the
+    function, so the cast overhead is part of its measurement. The mixed precision version is
+    chosen if it is faster and its outputs are within the given tolerance. Otherwise the operator
+    calls of the function are kept in float32 through the
+    `relay.ToMixedPrecision.keep_fp32_calls` pass config option.
+
+    Parameters
+    ----------
+    mod : tvm.IRModule
+        The float32 module, with the parameters to be converted bound as constants.
+    mixed_precision_type : str
+        The mixed precision type, e.g. "float16" or "bfloat16".
+    target : str
+        The local target to measure on.
+    rtol : float
+        The relative tolerance of the mixed precision outputs.
+    atol : float
+        The absolute tolerance of the mixed precision outputs.
+    number : int
+        The number of runs per measurement.
+    repeat : int
+        The number of measurements, whose mean is used.
+    missing_op_mode : int
+        How to handle ops not registered with FTVMMixedPrecisionConversionType,
+        see ToMixedPrecision.
+
+    Returns
+    -------
+    mod : tvm.IRModule
+        The module converted to mixed precision.
+    report : List[Dict[str, Any]]
+        The chosen precision of each fused function, with the float32 and mixed precision
+        latencies in seconds. The last entry holds the projected speedup of the whole module.
+    """
+    target = tvm.target.Target(target)
+    mod = InferType()(mod)
+    keep_fp32_calls = []
+    report = []
+    fp32_total = 0.0
+    chosen_total = 0.0
+    for func in relay.analysis.extract_fused_functions(mod).values():
+        func = relay.Function(func.params, func.body, func.ret_type, func.type_params)
+        fp32_mod = InferType()(tvm.IRModule.from_expr(func))
+        inputs = _random_inputs(fp32_mod["main"])
+        if inputs is None:
+            continue
+        with tvm.transform.PassContext(
+            config={"relay.ToMixedPrecision.keep_orig_output_dtype": True}
+        ):
+            mixed_mod = ToMixedPrecision(mixed_precision_type, missing_op_mode)(fp32_mod)
+        fp32_time, fp32_outputs = _measure(fp32_mod, inputs, target, number, repeat)
+        mixed_time, mixed_outputs = _measure(mixed_mod, inputs, target, number, repeat)
+        accurate = all(
+            np.allclose(mixed.astype(fp32.dtype), fp32, rtol=rtol, atol=atol)
+            for mixed, fp32 in zip(mixed_outputs, fp32_outputs)
+        )
+        use_mixed = accurate and mixed_time < fp32_time
+        if not use_mixed:
+            keep_fp32_calls.extend(_call_keys(fp32_mod["main"]))
+        fp32_total += fp32_time
+        chosen_total += mixed_time if use_mixed else fp32_time
+        report.append(
+            {
+                "function": str(func),
+                "precision": mixed_precision_type if use_mixed else "float32",
+                "accurate": accurate,
+                "fp32_latency": fp32_time,
+                "mixed_latency": mixed_time,
+            }
+        )
+    report.append({"projected_speedup": fp32_total / chosen_total if chosen_total > 0 else 1.0})
+
+    with tvm.transform.PassContext(
+        config={"relay.ToMixedPrecision.keep_fp32_calls": sorted(set(keep_fp32_calls))}
+    ):
+        mod = ToMixedPrecision(mixed_precision_type, missing_op_mode)(mod)
+    return mod, report
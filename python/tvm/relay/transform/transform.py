@@ -1391,6 +1391,32 @@ def SplitArgs(max_function_args):
     return _ffi_api.SplitArgs(max_function_args)
 
 
+def SpecializeShapeBuckets(buckets, func_name="main"):
+    """Add static-shape specializations of a function with dynamically shaped parameters.
+
+    For every bucket, a copy of the function in which the bucket's parameters have static
+    shapes is added to the module, so its kernels are compiled (and tuned) for static shapes.
+    The original function dispatches to the first copy matching the runtime shapes of its
+    arguments and falls back to its generic body otherwise. The Relay VM applies this pass to
+    "main" when the ``relay.vm.shape_buckets`` config is set.
+
+    Parameters
+    ----------
+    buckets : List[Dict[str, Tuple[int]]]
+        The shape buckets, in the order they are checked at runtime. Every bucket maps
+        parameter names to static shapes, e.g. ``[{"x": (1, 32)}, {"x": (1, 64)}]``.
+
+    func_name : str
+        The name of the global function to specialize.
+
+    Returns
+    -------
+    ret : tvm.transform.Pass
+        The registered pass.
+    """
+    return _ffi_api.SpecializeShapeBuckets(buckets, func_name)
+
+
 def OutlineCompilerFunctionsWithExistingGlobalSymbols(compiler_filter=""):
     """Outlines all literal functions in direct call positions which have a "Compiler"
     attribute.
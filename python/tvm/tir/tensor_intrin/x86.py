@@ -101,6 +101,137 @@ def dot_product_16x4_u8i8i32_avx512(
         )
 
 
+@T.prim_func
+def dot_product_8x4_u8i8i32_desc(
+    A: T.Buffer((4,), "uint8", offset_factor=1),
+    B: T.Buffer((8, 4), "int8", offset_factor=1),
+    C: T.Buffer((8,), "int32", offset_factor=1),
+) -> None:
+    with T.block("root"):
+        T.reads(C[0:8], A[0:4], B[0:8, 0:4])
+        T.writes(C[0:8])
+        for i in T.serial(0, 8):
+            for k in T.serial(0, 4):
+                with T.block("update"):
+                    vi, vk = T.axis.remap("SR", [i, k])
+                    C[vi] = C[vi] + T.cast(A[vk], "int32") * T.cast(B[vi, vk], "int32")
+
+
+@T.prim_func
+def dot_product_8x4_u8i8i32_avxvnni(
+    A: T.Buffer((4,), "uint8", offset_factor=1),
+    B: T.Buffer((8, 4), "int8", offset_factor=1),
+    C: T.Buffer((8,), "int32", offset_factor=1),
+) -> None:
+    with T.block("root"):
+        T.reads(C[0:8], A[0:4], B[0:8, 0:4])
+        T.writes(C[0:8])
+
+        A_u8x4 = A.vload([0], "uint8x4")
+        A_i32 = T.reinterpret(A_u8x4, dtype="int32")
+
+        B_i8x32 = B.vload([0, 0], dtype="int8x32")
+        B_i32x8 = T.reinterpret(B_i8x32, dtype="int32x8")
+        C_i32x8 = C.vload([0], dtype="int32x8")
+
+        # On targets with AVX-VNNI but without AVX512-VNNI, LLVM selects the VEX-encoded
+        # vpdpbusd for the 256-bit intrinsic.
+        C[T.ramp(T.int32(0), 1, 8)] = T.call_llvm_pure_intrin(
+            T.llvm_lookup_intrinsic_id("llvm.x86.avx512.vpdpbusd.256"),
+            T.uint32(3),
+            C_i32x8,
+            T.broadcast(A_i32, 8),
+            B_i32x8,
+            dtype="int32x8",
+        )
+
+
+# AMX-INT8 tile microkernel: C(16x16) += A(16x64) * B(16x64), where B is stored in the
+# VNNI-packed layout B[k // 4, j, k % 4] expected by tdpbusd. The tile configuration
+# (palette 1, 16 rows x 64 bytes for every tile) is emitted by the x86-64 LLVM codegen
+# for each function or parallel task that uses these intrinsics.
+
+
+@T.prim_func
+def dot_product_16x16x64_u8i8i32_desc(a: T.handle, b: T.handle, c: T.handle) -> None:
+    A = T.match_buffer(a, (16, 64), "uint8", offset_factor=1)
+    B = T.match_buffer(b, (16, 16, 4), "int8", offset_factor=1)
+    C = T.match_buffer(c, (16, 16), "int32", offset_factor=1)
+    with T.block("root"):
+        T.reads(C[0:16, 0:16], A[0:16, 0:64], B[0:16, 0:16, 0:4])
+        T.writes(C[0:16, 0:16])
+        for i, j, k in T.grid(16, 16, 64):
+            with T.block("update"):
+                vi, vj, vk = T.axis.remap("SSR", [i, j, k])
+                C[vi, vj] = C[vi, vj] + T.cast(A[vi, vk], "int32") * T.cast(
+                    B[vk // 4, vj, vk % 4], "int32"
+                )
+
+
+@T.prim_func
+def dot_product_16x16x64_u8i8i32_amx(a: T.handle, b: T.handle, c: T.handle) -> None:
+    lda = T.int32()
+    ldb = T.int32()
+    ldc = T.int32()
+    A = T.match_buffer(a, (16, 64), "uint8", offset_factor=1, strides=[lda, 1])
+    B = T.match_buffer(b, (16, 16, 4), "int8", offset_factor=1, strides=[ldb, 4, 1])
+    C = T.match_buffer(c, (16, 16), "int32", offset_factor=1, strides=[ldc, 1])
+    with T.block("root"):
+        T.reads(C[0:16, 0:16], A[0:16, 0:64], B[0:16, 0:16, 0:4])
+        T.writes(C[0:16, 0:16])
+        # tmm0 <- C, tmm1 <- A, tmm2 <- B; the strides are in bytes.
+        T.evaluate(
+            T.call_llvm_intrin(
+                T.llvm_lookup_intrinsic_id("llvm.x86.tileloadd64"),
+                T.uint32(0),
+                T.uint8(0),
+                C.access_ptr("r"),
+                T.Cast("int64", ldc * 4),
+                dtype="int32",
+            )
+        )
+        T.evaluate(
+            T.call_llvm_intrin(
+                T.llvm_lookup_intrinsic_id("llvm.x86.tileloadd64"),
+                T.uint32(0),
+                T.uint8(1),
+                A.access_ptr("r"),
+                T.Cast("int64", lda),
+                dtype="int32",
+            )
+        )
+        T.evaluate(
+            T.call_llvm_intrin(
+                T.llvm_lookup_intrinsic_id("llvm.x86.tileloadd64"),
+                T.uint32(0),
+                T.uint8(2),
+                B.access_ptr("r"),
+                T.Cast("int64", ldb),
+                dtype="int32",
+            )
+        )
+        T.evaluate(
+            T.call_llvm_intrin(
+                T.llvm_lookup_intrinsic_id("llvm.x86.tdpbusd"),
+                T.uint32(0),
+                T.uint8(0),
+                T.uint8(1),
+                T.uint8(2),
+                dtype="int32",
+            )
+        )
+        T.evaluate(
+            T.call_llvm_intrin(
+                T.llvm_lookup_intrinsic_id("llvm.x86.tilestored64"),
+                T.uint32(0),
+                T.uint8(0),
+                C.access_ptr("w"),
+                T.Cast("int64", ldc * 4),
+                dtype="int32",
+            )
+        )
+
+
 VNNI_DOT_16x4_INTRIN = "dot_16x4_vnni"
 
 TensorIntrin.register(
@@ -112,3 +243,15 @@ AVX512_DOT_16x4_INTRIN = "dot_16x4_avx512"
 TensorIntrin.register(
     AVX512_DOT_16x4_INTRIN, dot_product_16x4_u8i8i32_desc, dot_product_16x4_u8i8i32_avx512
 )
+
+AVXVNNI_DOT_8x4_INTRIN = "dot_8x4_avxvnni"
+
+TensorIntrin.register(
+    AVXVNNI_DOT_8x4_INTRIN, dot_product_8x4_u8i8i32_desc, dot_product_8x4_u8i8i32_avxvnni
+)
+
+AMX_DOT_16x16x64_INTRIN = "dot_16x16x64_amx"
+
+TensorIntrin.register(
+    AMX_DOT_16x16x64_INTRIN, dot_product_16x16x64_u8i8i32_desc, dot_product_16x16x64_u8i8i32_amx
+)
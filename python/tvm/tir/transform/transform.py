@@ -59,6 +59,21 @@ def InjectPrefetch():
     return _ffi_api.InjectPrefetch()  # type: ignore
 
 
+def InjectSoftwarePrefetch():
+    """Insert software prefetches for the strided and indirect loads of
+    innermost loops on CPU targets.
+
+    The prefetch distance is taken from the "tir.InjectSoftwarePrefetch"
+    config, or from an enclosing "pragma_software_prefetch" attribute.
+
+    Returns
+    -------
+    fpass : tvm.transform.Pass
+        The result pass
+    """
+    return _ffi_api.InjectSoftwarePrefetch()  # type: ignore
+
+
 def ApplyLayoutTransforms():
     """Reshape buffers that appear in the "layout_transform_map"
     fucntion attribute.
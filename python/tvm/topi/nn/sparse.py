@@ -221,7 +221,7 @@ def _sparse_dense_sp_rhs_bsrmm(data, weight_data, weight_indices, weight_indptr)
         (m, num_blocks, bs_r),
         _compute_block,
         tag="sparse_dense_sp_rhs_bsrmm_block",
-        attrs={"FLOP": 2 * m * num_blocks * bs_r * k},
+        attrs={"FLOP": 2 * m * num_blocks * bs_r * k, "schedule_rule": "sparse_dense_bsr"},
     )
     return te.compute(
         (m, num_blocks * bs_r),
@@ -203,6 +203,26 @@ pub extern "C" fn TVMBackendParallelLaunch(
     0
 }
 
+/// Runs independent tasks one after another, each as a single-threaded group.
+#[no_mangle]
+pub extern "C" fn TVMBackendParallelDispatch(
+    cb: FTVMParallelLambda,
+    cdata: *const c_void,
+    num_task: usize,
+) -> c_int {
+    let penv = TVMParallelGroupEnv {
+        sync_handle: std::ptr::null_mut(),
+        num_task: 1,
+    };
+    for task_id in 0..num_task {
+        let res = cb(task_id, &penv as *const _, cdata);
+        if res != 0 {
+            return res;
+        }
+    }
+    0
+}
+
 // @see issue 988 for information on why this function is used.
 #[no_mangle]
 pub unsafe extern "C" fn TVMBackendParallelBarrier(
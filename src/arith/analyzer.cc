@@ -49,6 +49,7 @@ void Analyzer::Bind(const Var& var, const PrimExpr& expr, bool allow_override) {
   this->canonical_simplify.Update(var, new_expr, allow_override);
   this->int_set.Update(var, this->int_set(new_expr), allow_override);
   this->transitive_comparisons.Bind(var, expr, allow_override);
+  this->simplify_cache.Clear();
 }
 
 void Analyzer::Bind(const Var& var, const Range& range, bool allow_override) {
@@ -59,6 +60,7 @@ void Analyzer::Bind(const Var& var, const Range& range, bool allow_override) {
     this->const_int_bound.Bind(var, range, allow_override);
     this->int_set.Bind(var, range, allow_override);
     this->transitive_comparisons.Bind(var, range, allow_override);
+    this->simplify_cache.Clear();
   }
   // skip modular_set
   // skip rewrite simplify
@@ -111,6 +113,7 @@ void Analyzer::MarkGlobalNonNegValue(const PrimExpr& value) {
     // during bound proof which is not our intention
     this->const_int_bound.Update(var, ConstIntBound(-offset, ConstIntBound::kPosInf),
                                  allow_override);
+    this->simplify_cache.Clear();
   }
 }
 
@@ -123,11 +126,15 @@ void Analyzer::Bind(const Map<Var, Range>& variables, bool allow_override) {
 void ConstraintContext::EnterWithScope() {
   ICHECK(recovery_functions_.size() == 0);
   // entering the scope.
+  // Nothing simplified while the sub-analyzers take in the constraint is memoized, the
+  // simplify cache only opens the constraint's scope once all of them have entered it.
+  analyzer_->simplify_cache.Suspend();
   recovery_functions_.push_back(analyzer_->const_int_bound.EnterConstraint(constraint_));
   recovery_functions_.push_back(analyzer_->modular_set.EnterConstraint(constraint_));
   recovery_functions_.push_back(analyzer_->rewrite_simplify.EnterConstraint(constraint_));
   recovery_functions_.push_back(analyzer_->int_set.EnterConstraint(constraint_));
   recovery_functions_.push_back(analyzer_->transitive_comparisons.EnterConstraint(constraint_));
+  recovery_functions_.push_back(analyzer_->simplify_cache.EnterConstraint(constraint_));
 }
 
 void ConstraintContext::ExitWithScope() {
@@ -231,6 +238,12 @@ bool Analyzer::CanProve(const PrimExpr& expr, ProofStrength strength) {
 }
 
 PrimExpr Analyzer::Simplify(const PrimExpr& expr, int steps) {
+  int extensions = static_cast<int>(this->rewrite_simplify.GetEnabledExtensions());
+  size_t hash = 0;
+  if (Optional<PrimExpr> cached = this->simplify_cache.Lookup(expr, steps, extensions, &hash)) {
+    return cached.value();
+  }
+
   PrimExpr res = expr;
 
   // Always starts with a canonical simplification, as some structural property
@@ -239,7 +252,7 @@ PrimExpr Analyzer::Simplify(const PrimExpr& expr, int steps) {
 
   for (int i = 0; i < steps; ++i) {
     if (tir::is_const_int(res)) {
-      return res;
+      break;
     }
     if (i % 2 == 0) {
       res = this->rewrite_simplify(res);
@@ -248,6 +261,7 @@ PrimExpr Analyzer::Simplify(const PrimExpr& expr, int steps) {
     }
   }
 
+  this->simplify_cache.Insert(expr, steps, extensions, hash, res);
   return res;
 }
 
@@ -265,6 +279,7 @@ TVM_REGISTER_GLOBAL("arith.CreateAnalyzer").set_body([](TVMArgs args, TVMRetValu
     } else if (name == "const_int_bound_update") {
       return PackedFunc([self](TVMArgs args, TVMRetValue* ret) {
         self->const_int_bound.Update(args[0], args[1], args[2]);
+        self->simplify_cache.Clear();
       });
     } else if (name == "Simplify") {
       return PackedFunc([self](TVMArgs args, TVMRetValue* ret) {
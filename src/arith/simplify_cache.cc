@@ -0,0 +1,167 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file tvm/arith/simplify_cache.cc
+ * \brief Memoization of Analyzer::Simplify.
+ */
+#include <tvm/arith/analyzer.h>
+#include <tvm/node/structural_equal.h>
+#include <tvm/node/structural_hash.h>
+#include <tvm/tir/expr.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include "../support/utils.h"
+
+namespace tvm {
+namespace arith {
+
+using namespace tir;
+
+class SimplifyCache::Impl {
+ public:
+  Optional<PrimExpr> Lookup(const PrimExpr& expr, int steps, int extensions, size_t* hash) {
+    if (!Enabled() || !Memoizable(expr)) return NullOpt;
+    Key key{expr, steps, extensions, 0};
+    key.hash = Hash(key);
+    *hash = key.hash;
+    auto it = scopes_.back().find(key);
+    if (it == scopes_.back().end()) {
+      ++misses_;
+      return NullOpt;
+    }
+    ++hits_;
+    // Preserve object identity for callers testing whether anything changed.
+    return it->second.unchanged ? expr : it->second.result;
+  }
+
+  void Insert(const PrimExpr& expr, int steps, int extensions, size_t hash,
+              const PrimExpr& result) {
+    if (!Enabled() || !Memoizable(expr)) return;
+    Table& table = scopes_.back();
+    if (table.size() >= capacity_) table.clear();
+    table[Key{expr, steps, extensions, hash}] = Entry{result, result.same_as(expr)};
+  }
+
+  void Clear() {
+    for (Table& table : scopes_) {
+      table.clear();
+    }
+  }
+
+  void Suspend() { ++suspended_; }
+
+  std::function<void()> EnterConstraint() {
+    ICHECK_GT(suspended_, 0);
+    --suspended_;
+    scopes_.emplace_back();
+    size_t depth = scopes_.size();
+    return [depth, this]() {
+      ICHECK_EQ(scopes_.size(), depth);
+      scopes_.pop_back();
+    };
+  }
+
+  size_t capacity_{kDefaultCapacity};
+  int64_t hits_{0};
+  int64_t misses_{0};
+
+ private:
+  struct Key {
+    PrimExpr expr;
+    int steps;
+    int extensions;
+    size_t hash;
+  };
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return key.hash; }
+  };
+  struct KeyEqual {
+    bool operator()(const Key& lhs, const Key& rhs) const {
+      return lhs.hash == rhs.hash && lhs.steps == rhs.steps && lhs.extensions == rhs.extensions &&
+             (lhs.expr.same_as(rhs.expr) || StructuralEqual()(lhs.expr, rhs.expr));
+    }
+  };
+  struct Entry {
+    PrimExpr result;
+    /*! \brief Whether the result was the input itself. */
+    bool unchanged;
+  };
+  using Table = std::unordered_map<Key, Entry, KeyHash, KeyEqual>;
+
+  bool Enabled() const { return capacity_ != 0 && suspended_ == 0; }
+
+  /*! \brief Leaves are cheaper to simplify than to hash. */
+  static bool Memoizable(const PrimExpr& expr) {
+    return !expr->IsInstance<IntImmNode>() && !expr->IsInstance<FloatImmNode>() &&
+           !expr->IsInstance<VarNode>();
+  }
+
+  static size_t Hash(const Key& key) {
+    uint64_t hash = StructuralHash()(key.expr);
+    hash = support::HashCombine(hash, key.steps);
+    return support::HashCombine(hash, key.extensions);
+  }
+
+  /*! \brief The tables of the enclosing constraint scopes, innermost last. */
+  std::vector<Table> scopes_{1};
+  /*! \brief Number of constraints currently being entered. */
+  int suspended_{0};
+};
+
+SimplifyCache::SimplifyCache() : impl_(std::make_unique<Impl>()) {}
+
+SimplifyCache::~SimplifyCache() {}
+
+void SimplifyCache::Clear() { impl_->Clear(); }
+
+void SimplifyCache::SetCapacity(size_t capacity) {
+  impl_->capacity_ = capacity;
+  impl_->Clear();
+}
+
+int64_t SimplifyCache::hits() const { return impl_->hits_; }
+
+int64_t SimplifyCache::misses() const { return impl_->misses_; }
+
+void SimplifyCache::ResetStatsCounters() {
+  impl_->hits_ = 0;
+  impl_->misses_ = 0;
+}
+
+Optional<PrimExpr> SimplifyCache::Lookup(const PrimExpr& expr, int steps, int extensions,
+                                         size_t* hash) {
+  return impl_->Lookup(expr, steps, extensions, hash);
+}
+
+void SimplifyCache::Insert(const PrimExpr& expr, int steps, int extensions, size_t hash,
+                           const PrimExpr& result) {
+  impl_->Insert(expr, steps, extensions, hash, result);
+}
+
+void SimplifyCache::Suspend() { impl_->Suspend(); }
+
+std::function<void()> SimplifyCache::EnterConstraint(const PrimExpr& constraint) {
+  return impl_->EnterConstraint();
+}
+
+}  // namespace arith
+}  // namespace tvm
@@ -38,6 +38,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <queue>
+#include <sstream>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -1125,6 +1127,7 @@ ComputeDAG ComputeDAG::RewriteLayout(Array<Step>* transform_steps,
     }  // end for placeholder
   }    // end for stage
   p_dag->access_analyzer = AccessAnalyzer(p_dag->tensors);
+  p_dag->infer_bound_cache.Clear();
 
   Array<te::Operation> out_ops;
   for (const auto& op : p_dag->access_analyzer->ops_topo_order) {
@@ -1306,6 +1309,91 @@ String ComputeDAG::PrintDAG(bool simple_mode) const {
   return String(ss.str());
 }
 
+bool InferBoundCache::Get(const std::string& key, Array<Array<Range>>* ranges) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    return false;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  *ranges = it->second->second;
+  return true;
+}
+
+void InferBoundCache::Put(const std::string& key, const Array<Array<Range>>& ranges) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    entries_.splice(entries_.begin(), entries_, it->second);
+    it->second->second = ranges;
+    return;
+  }
+  entries_.emplace_front(key, ranges);
+  index_[key] = entries_.begin();
+  if (entries_.size() > kCapacity) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
+
+void InferBoundCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+}
+
+/*! \brief Serialize the transform steps as the key of InferBoundCache. */
+static std::string InferBoundCacheKey(const Array<Step>& transform_steps) {
+  std::ostringstream os;
+  dmlc::JSONWriter writer(&os);
+  writer.BeginArray(false);
+  for (const auto& step : transform_steps) {
+    writer.WriteArraySeperator();
+    writer.BeginArray(false);
+    step->WriteToRecord(&writer);
+    writer.EndArray();
+  }
+  writer.EndArray();
+  return os.str();
+}
+
+/*!
+ * \brief Set the inferred ranges to the iterators of the stages of a state.
+ * \param pstate The state to update.
+ * \param ranges The ranges of the iterators of each stage, empty for inlined stages.
+ * \return Whether the ranges match the stages and iterators of the state.
+ */
+static bool SetStageRanges(StateNode* pstate, const Array<Array<Range>>& ranges) {
+  if (ranges.size() != pstate->stages.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < pstate->stages.size(); ++i) {
+    const Stage& stage = pstate->stages[i];
+    if (stage->compute_at != ComputeAtKind::kInlined &&
+        ranges[i].size() != stage->iters.size()) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < pstate->stages.size(); ++i) {
+    const Stage& stage = pstate->stages[i];
+    if (stage->compute_at == ComputeAtKind::kInlined) {
+      continue;
+    }
+
+    Array<Iterator> new_iters;
+    new_iters.reserve(stage->iters.size());
+    for (size_t j = 0; j < stage->iters.size(); ++j) {
+      const Iterator& iter = stage->iters[j];
+      new_iters.push_back(Iterator(iter->name, ranges[i][j], iter->iter_kind, iter->annotation,
+                                   &iter->orig_iters));
+    }
+
+    pstate->stages.Set(
+        i, Stage(stage->op, stage->op_type, new_iters, stage->compute_at, stage->attrs));
+  }
+  return true;
+}
+
 State ComputeDAG::InferBound(const State& state) const {
   ICHECK(state->concrete) << "Only concrete state can be processed to get bound info.";
 
@@ -1326,6 +1414,16 @@ State ComputeDAG::InferBound(const State& state) const {
     pstate = ret_state.CopyOnWrite();
   }
 
+  // States with the same steps have the same iterator ranges, reuse the memoized ones.
+  // The stages are rebuilt from the ops of this state, which differ from the ops of the cached
+  // state when the steps create new stages.
+  const std::string cache_key = InferBoundCacheKey(pstate->transform_steps);
+  Array<Array<Range>> cached_ranges;
+  if (operator->()->infer_bound_cache.Get(cache_key, &cached_ranges) &&
+      SetStageRanges(pstate, cached_ranges)) {
+    return ret_state;
+  }
+
   Array<te::Stage> stages;
   StageToAxesMap stage_to_axes;
   // Replay steps to tvm::Schedule
@@ -1335,35 +1433,29 @@ State ComputeDAG::InferBound(const State& state) const {
   // Get bound information from TVM schedule
   Map<IterVar, Range> bounds = te::InferBound(sch);
 
-  // Update the state bound information
+  // Get bound information from schedule
+  // the StageToAxesMap is used to find the corresponding IterVar in TVM schedule result
+  Array<Array<Range>> ranges;
+  ranges.reserve(pstate->stages.size());
   for (size_t i = 0; i < pstate->stages.size(); ++i) {
     const Stage& stage = pstate->stages[i];
-
-    if (stage->compute_at == ComputeAtKind::kInlined) {
-      continue;
-    }
-
-    Array<Iterator> new_iters;
-    new_iters.reserve(stage->iters.size());
-    // Get bound information from schedule
-    // the StageToAxesMap is used to find the corresponding IterVar in TVM schedule result
-    for (size_t j = 0; j < stage->iters.size(); ++j) {
-      const Iterator& iter = stage->iters[j];
-      const IterVar& axis = stage_to_axes.at(stages[i])[j];
-
-      auto find_res = bounds.find(axis);
-      if (find_res != bounds.end()) {
-        new_iters.push_back(Iterator(iter->name, (*find_res).second, iter->iter_kind,
-                                     iter->annotation, &iter->orig_iters));
-      } else {
-        LOG(FATAL) << "Infer bound fails";
+    Array<Range> stage_ranges;
+    if (stage->compute_at != ComputeAtKind::kInlined) {
+      for (size_t j = 0; j < stage->iters.size(); ++j) {
+        const IterVar& axis = stage_to_axes.at(stages[i])[j];
+        auto find_res = bounds.find(axis);
+        if (find_res == bounds.end()) {
+          LOG(FATAL) << "Infer bound fails";
+        }
+        stage_ranges.push_back((*find_res).second);
       }
     }
-
-    pstate->stages.Set(
-        i, Stage(stage->op, stage->op_type, new_iters, stage->compute_at, stage->attrs));
+    ranges.push_back(stage_ranges);
   }
 
+  // Update the state bound information
+  ICHECK(SetStageRanges(pstate, ranges));
+  operator->()->infer_bound_cache.Put(cache_key, ranges);
   return ret_state;
 }
 
@@ -229,6 +229,7 @@ Array<tvm::transform::Pass> CreatePassList(bool disable_loop_partition) {
   }
 
   pass_list.push_back(tir::transform::VectorizeLoop(!disable_vectorize));
+  pass_list.push_back(tir::transform::InjectSoftwarePrefetch());
   pass_list.push_back(tir::transform::InjectVirtualThread());
   pass_list.push_back(tir::transform::InjectDoubleBuffer());
   if (!disable_storage_rewrite) {
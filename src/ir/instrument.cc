@@ -24,10 +24,18 @@
 #include <dmlc/thread_local.h>
 #include <tvm/ir/instrument.h>
 #include <tvm/ir/transform.h>
+#include <tvm/node/reflection.h>
 #include <tvm/node/repr_printer.h>
+#include <tvm/runtime/memory.h>
 #include <tvm/runtime/registry.h>
 
+#include <chrono>
+#include <iomanip>
 #include <stack>
+#include <unordered_set>
+#include <vector>
+
+#include "../support/str_escape.h"
 
 namespace tvm {
 namespace instrument {
@@ -334,5 +342,276 @@ TVM_REGISTER_GLOBAL("instrument.MakePassTimingInstrument").set_body_typed([]() {
                             run_before_pass, run_after_pass);
 });
 
+/*! \brief Counts the distinct objects reachable from an IR root through reflection. */
+class IRNodeCounter : public AttrVisitor {
+ public:
+  int64_t Count(const ObjectRef& root) {
+    Push(root);
+    while (!stack_.empty()) {
+      Object* node = stack_.back();
+      stack_.pop_back();
+      if (node->IsInstance<ArrayNode>()) {
+        for (const ObjectRef& elem : *static_cast<const ArrayNode*>(node)) {
+          Push(elem);
+        }
+      } else if (node->IsInstance<MapNode>()) {
+        for (const auto& kv : *static_cast<const MapNode*>(node)) {
+          Push(kv.first);
+          Push(kv.second);
+        }
+      } else {
+        ReflectionVTable::Global()->VisitAttrs(node, this);
+      }
+    }
+    return static_cast<int64_t>(visited_.size());
+  }
+
+  void Visit(const char* key, double* value) final {}
+  void Visit(const char* key, int64_t* value) final {}
+  void Visit(const char* key, uint64_t* value) final {}
+  void Visit(const char* key, int* value) final {}
+  void Visit(const char* key, bool* value) final {}
+  void Visit(const char* key, std::string* value) final {}
+  void Visit(const char* key, void** value) final {}
+  void Visit(const char* key, DataType* value) final {}
+  void Visit(const char* key, runtime::NDArray* value) final {}
+  void Visit(const char* key, ObjectRef* value) final { Push(*value); }
+
+ private:
+  void Push(const ObjectRef& obj) {
+    if (obj.defined() && visited_.insert(obj.get()).second) {
+      stack_.push_back(const_cast<Object*>(obj.get()));
+    }
+  }
+
+  std::unordered_set<const Object*> visited_;
+  std::vector<Object*> stack_;
+};
+
+/*!
+ * \brief Native pass instrument recording, for every pass including the ones nested in
+ *  sequential passes, its wall time, the number of objects allocated while it ran and the
+ *  number of IR nodes before and after it.
+ *
+ * Time and allocations spent in the instrument itself (mostly counting IR nodes) are kept out
+ * of the recorded numbers: they are measured on a virtual clock and allocation counter which
+ * stand still while the instrument runs. Allocations are counted on the thread running the
+ * passes only, and only when built with USE_OBJECT_ALLOCATION_COUNT; otherwise they are left
+ * out of the reports.
+ */
+class PassProfilingInstrumentNode : public PassInstrumentNode {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using Duration = std::chrono::duration<double, std::micro>;
+
+  /*! \brief The profile of a single pass invocation. */
+  struct Record {
+    /*! \brief The name of the pass. */
+    String name;
+    /*! \brief The virtual start and end time, in microseconds since entering the context. */
+    double start{0};
+    double end{0};
+    /*! \brief The virtual allocation counter at the start and the end of the pass. */
+    uint64_t allocs_start{0};
+    uint64_t allocs_end{0};
+    /*! \brief The number of IR nodes before and after the pass, -1 if not counted. */
+    int64_t nodes_before{-1};
+    int64_t nodes_after{-1};
+    /*! \brief The passes invoked by this pass. */
+    std::vector<Record> children;
+  };
+
+  /*! \brief Whether to count the IR nodes before and after every pass. */
+  bool count_ir_nodes{true};
+
+  void EnterPassContext() const final {
+    roots_.clear();
+    stack_.clear();
+    base_ = Clock::now();
+    overhead_time_ = Duration(0);
+    overhead_allocs_ = 0;
+  }
+
+  void ExitPassContext() const final {
+    // Passes aborted by an exception never reach RunAfterPass, close them here.
+    while (!stack_.empty()) {
+      stack_.back()->end = Now();
+      stack_.back()->allocs_end = Allocations();
+      stack_.pop_back();
+    }
+  }
+
+  bool ShouldRun(const IRModule& mod, const transform::PassInfo& info) const final {
+    return true;
+  }
+
+  void RunBeforePass(const IRModule& mod, const transform::PassInfo& info) const final {
+    Clock::time_point overhead_start = Clock::now();
+    uint64_t allocs_before = runtime::detail::ThreadLocalObjectAllocationCount();
+
+    std::vector<Record>* siblings = stack_.empty() ? &roots_ : &stack_.back()->children;
+    siblings->emplace_back();
+    Record* record = &siblings->back();
+    record->name = info->name;
+    if (count_ir_nodes) {
+      record->nodes_before = IRNodeCounter().Count(mod);
+    }
+    stack_.push_back(record);
+
+    AddOverhead(overhead_start, allocs_before);
+    record->start = Now();
+    record->allocs_start = Allocations();
+  }
+
+  void RunAfterPass(const IRModule& mod, const transform::PassInfo& info) const final {
+    ICHECK(!stack_.empty()) << "mismatched enter/exit for pass profiling";
+    Record* record = stack_.back();
+    record->end = Now();
+    record->allocs_end = Allocations();
+
+    Clock::time_point overhead_start = Clock::now();
+    uint64_t allocs_before = runtime::detail::ThreadLocalObjectAllocationCount();
+    if (count_ir_nodes) {
+      record->nodes_after = IRNodeCounter().Count(mod);
+    }
+    stack_.pop_back();
+    AddOverhead(overhead_start, allocs_before);
+  }
+
+  /*! \brief Render the profiles as an indented tree, one pass per line. */
+  String Render() const {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(0);
+    double total = 0;
+    for (const Record& record : roots_) {
+      total += record.end - record.start;
+    }
+    for (const Record& record : roots_) {
+      RenderRecord(record, 0, total, &os);
+    }
+    return os.str();
+  }
+
+  /*! \brief Render the profiles in the Chrome trace event format. */
+  String ChromeTrace() const {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    bool first = true;
+    for (const Record& record : roots_) {
+      TraceRecord(record, &first, &os);
+    }
+    os << "\n]}\n";
+    return os.str();
+  }
+
+  void VisitAttrs(AttrVisitor* v) {
+    PassInstrumentNode::VisitAttrs(v);
+    v->Visit("count_ir_nodes", &count_ir_nodes);
+  }
+
+  static constexpr const char* _type_key = "instrument.PassProfilingInstrument";
+  TVM_DECLARE_FINAL_OBJECT_INFO(PassProfilingInstrumentNode, PassInstrumentNode);
+
+ private:
+  double Now() const { return (Duration(Clock::now() - base_) - overhead_time_).count(); }
+
+  uint64_t Allocations() const {
+    return runtime::detail::ThreadLocalObjectAllocationCount() - overhead_allocs_;
+  }
+
+  void AddOverhead(Clock::time_point start, uint64_t allocs_before) const {
+    overhead_time_ += Duration(Clock::now() - start);
+    overhead_allocs_ += runtime::detail::ThreadLocalObjectAllocationCount() - allocs_before;
+  }
+
+  static void RenderRecord(const Record& record, size_t depth, double total,
+                           std::ostringstream* os) {
+    double duration = record.end - record.start;
+    double self_duration = duration;
+    uint64_t allocs = record.allocs_end - record.allocs_start;
+    uint64_t self_allocs = allocs;
+    for (const Record& child : record.children) {
+      self_duration -= child.end - child.start;
+      self_allocs -= child.allocs_end - child.allocs_start;
+    }
+    for (size_t i = 0; i < depth; ++i) {
+      *os << "\t";
+    }
+    *os << record.name << ": " << duration << "us [" << self_duration << "us] ("
+        << std::setprecision(2) << (total > 0 ? duration / total * 100.0 : 0.0) << "%)";
+    if (TVM_OBJECT_ALLOCATION_COUNT) {
+      *os << " " << std::setprecision(0) << allocs << " allocs [" << self_allocs << " allocs]";
+    }
+    if (record.nodes_before >= 0 && record.nodes_after >= 0) {
+      *os << " IR nodes " << record.nodes_before << " -> " << record.nodes_after;
+    }
+    *os << "\n";
+    for (const Record& child : record.children) {
+      RenderRecord(child, depth + 1, total, os);
+    }
+  }
+
+  static void TraceRecord(const Record& record, bool* first, std::ostringstream* os) {
+    *os << (*first ? "\n" : ",\n");
+    *first = false;
+    *os << "  {\"name\": \"" << support::StrEscape(record.name) << "\", \"cat\": \"pass\", "
+        << "\"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": " << record.start
+        << ", \"dur\": " << record.end - record.start << ", \"args\": {";
+    const char* sep = "";
+    if (TVM_OBJECT_ALLOCATION_COUNT) {
+      *os << "\"allocations\": " << record.allocs_end - record.allocs_start;
+      sep = ", ";
+    }
+    if (record.nodes_before >= 0 && record.nodes_after >= 0) {
+      *os << sep << "\"ir_nodes_before\": " << record.nodes_before
+          << ", \"ir_nodes_after\": " << record.nodes_after;
+    }
+    *os << "}}";
+    for (const Record& child : record.children) {
+      TraceRecord(child, first, os);
+    }
+  }
+
+  /*! \brief The profiles of the top-level passes. */
+  mutable std::vector<Record> roots_;
+  /*! \brief The passes currently running, innermost last. */
+  mutable std::vector<Record*> stack_;
+  /*! \brief The time the pass context was entered. */
+  mutable Clock::time_point base_;
+  /*! \brief Time and allocations spent in the instrument itself. */
+  mutable Duration overhead_time_{0};
+  mutable uint64_t overhead_allocs_{0};
+};
+
+/*!
+ * \brief Managed reference class for PassProfilingInstrumentNode
+ * \sa PassProfilingInstrumentNode
+ */
+class PassProfilingInstrument : public PassInstrument {
+ public:
+  explicit PassProfilingInstrument(bool count_ir_nodes) {
+    auto n = make_object<PassProfilingInstrumentNode>();
+    n->name = "PassProfilingInstrument";
+    n->count_ir_nodes = count_ir_nodes;
+    data_ = std::move(n);
+  }
+
+  TVM_DEFINE_OBJECT_REF_METHODS(PassProfilingInstrument, PassInstrument,
+                                PassProfilingInstrumentNode);
+};
+
+TVM_REGISTER_NODE_TYPE(PassProfilingInstrumentNode);
+
+TVM_REGISTER_GLOBAL("instrument.MakePassProfilingInstrument").set_body_typed([](bool count) {
+  return PassProfilingInstrument(count);
+});
+
+TVM_REGISTER_GLOBAL("instrument.RenderPassProfilingReport")
+    .set_body_typed([](PassProfilingInstrument inst) { return inst->Render(); });
+
+TVM_REGISTER_GLOBAL("instrument.PassProfilingChromeTrace")
+    .set_body_typed([](PassProfilingInstrument inst) { return inst->ChromeTrace(); });
+
 }  // namespace instrument
 }  // namespace tvm
@@ -0,0 +1,166 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <fstream>
+
+#include "../utils.h"
+#include "../worker_pool.h"
+
+namespace tvm {
+namespace meta_schedule {
+
+/*! \brief The builder that dispatches the builds to a pool of worker daemons. */
+class WorkerPoolBuilderNode final : public BuilderNode {
+ public:
+  /*! \brief The addresses of the workers. */
+  Array<String> workers;
+  /*! \brief The timeout of each build in seconds. */
+  double timeout_sec;
+  /*! \brief The time without heartbeat after which a worker is considered dead. */
+  double heartbeat_timeout_sec;
+  /*! \brief The maximal number of times a build is re-dispatched after worker failures. */
+  int max_retries;
+
+  /*! \brief The connections to the workers. */
+  std::shared_ptr<WorkerPool> pool_;
+  /*! \brief The artifacts built, keyed by the structural hash of the module and the target. */
+  std::unordered_map<std::string, std::vector<std::pair<IRModule, String>>> artifact_cache_;
+
+  void VisitAttrs(tvm::AttrVisitor* v) {
+    v->Visit("workers", &workers);
+    v->Visit("timeout_sec", &timeout_sec);
+    v->Visit("heartbeat_timeout_sec", &heartbeat_timeout_sec);
+    v->Visit("max_retries", &max_retries);
+    // `pool_` is not visited
+    // `artifact_cache_` is not visited
+  }
+
+  static constexpr const char* _type_key = "meta_schedule.WorkerPoolBuilder";
+  TVM_DECLARE_FINAL_OBJECT_INFO(WorkerPoolBuilderNode, BuilderNode);
+
+ public:
+  Array<BuilderResult> Build(const Array<BuilderInput>& build_inputs) final {
+    auto _ = Profiler::TimedScope("WorkerPoolBuilder");
+    int n = build_inputs.size();
+    // Step 1. Look up the artifacts built before, and deduplicate the rest
+    std::vector<Optional<String>> artifacts(n, NullOpt);
+    std::vector<int> job_ids(n, -1);
+    std::vector<std::string> keys(n);
+    std::vector<std::string> payloads;
+    std::unordered_map<std::string, std::vector<int>> pending;
+    for (int i = 0; i < n; ++i) {
+      const BuilderInput& input = build_inputs[i];
+      String target = input->target->str();
+      keys[i] = std::to_string(StructuralHash()(input->mod)) + "@" + target;
+      if ((artifacts[i] = LookupArtifact(keys[i], input->mod))) {
+        artifacts[i] = CopyArtifact(artifacts[i].value());
+        continue;
+      }
+      for (int j : pending[keys[i]]) {
+        if (StructuralEqual()(input->mod, build_inputs[j]->mod)) {
+          job_ids[i] = job_ids[j];
+          break;
+        }
+      }
+      if (job_ids[i] == -1) {
+        job_ids[i] = payloads.size();
+        payloads.push_back(SaveJSON(Array<ObjectRef>{input->mod, target}));
+        pending[keys[i]].push_back(i);
+      }
+    }
+    // Step 2. Build the rest on the workers
+    std::vector<WorkerPool::Result> job_results = pool_->Run("build", payloads);
+    std::vector<bool> job_delivered(payloads.size(), false);
+    Array<BuilderResult> results;
+    results.reserve(n);
+    for (int i = 0; i < n; ++i) {
+      if (artifacts[i].defined()) {
+        results.push_back(BuilderResult(artifacts[i], NullOpt));
+        continue;
+      }
+      const WorkerPool::Result& job_result = job_results[job_ids[i]];
+      if (!job_result.ok) {
+        results.push_back(BuilderResult(NullOpt, String(job_result.payload)));
+        continue;
+      }
+      String artifact_path = job_result.payload;
+      if (!job_delivered[job_ids[i]]) {
+        job_delivered[job_ids[i]] = true;
+        artifact_cache_[keys[i]].emplace_back(build_inputs[i]->mod, artifact_path);
+      } else {
+        artifact_path = CopyArtifact(artifact_path);
+      }
+      results.push_back(BuilderResult(artifact_path, NullOpt));
+    }
+    return results;
+  }
+
+ private:
+  /*!
+   * \brief Copy an artifact handed out more than once, since the measure callbacks remove the
+   * build directory of each result.
+   */
+  static String CopyArtifact(const String& artifact_path) {
+    static const PackedFunc* f_copy = runtime::Registry::Get("meta_schedule.copy_build_dir");
+    ICHECK(f_copy != nullptr) << "The `copy_build_dir` func is not in tvm registry.";
+    return (*f_copy)(artifact_path);
+  }
+
+  /*!
+   * \brief Find the artifact built from the same module and target. The measure callbacks may
+   * have removed it, in which case it is dropped from the cache.
+   */
+  Optional<String> LookupArtifact(const std::string& key, const IRModule& mod) {
+    auto it = artifact_cache_.find(key);
+    if (it == artifact_cache_.end()) {
+      return NullOpt;
+    }
+    std::vector<std::pair<IRModule, String>>& entries = it->second;
+    for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+      if (StructuralEqual()(entry->first, mod)) {
+        String artifact_path = entry->second;
+        if (std::ifstream(std::string(artifact_path)).good()) {
+          return artifact_path;
+        }
+        entries.erase(entry);
+        return NullOpt;
+      }
+    }
+    return NullOpt;
+  }
+};
+
+Builder Builder::WorkerPoolBuilder(Array<String> workers, double timeout_sec,
+                                   double heartbeat_timeout_sec, int max_retries) {
+  ObjectPtr<WorkerPoolBuilderNode> n = make_object<WorkerPoolBuilderNode>();
+  n->pool_ =
+      std::make_shared<WorkerPool>(workers, timeout_sec, heartbeat_timeout_sec, max_retries);
+  n->workers = std::move(workers);
+  n->timeout_sec = timeout_sec;
+  n->heartbeat_timeout_sec = heartbeat_timeout_sec;
+  n->max_retries = max_retries;
+  return Builder(std::move(n));
+}
+
+TVM_REGISTER_NODE_TYPE(WorkerPoolBuilderNode);
+TVM_REGISTER_GLOBAL("meta_schedule.BuilderWorkerPoolBuilder")
+    .set_body_typed(Builder::WorkerPoolBuilder);
+
+}  // namespace meta_schedule
+}  // namespace tvm
@@ -18,6 +18,7 @@
  */
 #include <tvm/tir/transform.h>
 
+#include <array>
 #include <cmath>
 #include <memory>
 #include <numeric>
@@ -108,29 +109,26 @@ int64_t FirstLoopExtent(const ForVec& loops, int64_t default_value) {
 }
 
 /*!
- * \brief Relax each of the multi-indexing pattern according to the domains bound in the analyzer,
- * and then union them into a single region
- * \param multi_index_pattern A list of multi-index pattern to be relaxed
+ * \brief Union the bounds of a list of multi-indices into a single region
+ * \param bounds bounds[j][i] is the (min, max) of the i-th dimension of the j-th multi-index
  * \param numel The size of the single region after union
- * \param analyzer The analyzer that contains the domain information
- * \return The relaxed and unioned region
+ * \return The shape of the unioned region
  */
-IntVec RelaxAndUnion(const std::vector<MultiIndex>& multi_indices, int64_t* numel,
-                     arith::Analyzer* analyzer) {
+IntVec UnionBounds(const std::vector<std::vector<std::pair<int64_t, int64_t>>>& bounds,
+                   int64_t* numel) {
   *numel = 1;
-  if (multi_indices.empty()) {
+  if (bounds.empty()) {
     return {};
   }
-  int n_indices = multi_indices.size();
-  int ndim = multi_indices[0].size();
+  int n_indices = bounds.size();
+  int ndim = bounds[0].size();
   IntVec access_shape(ndim, 0);
   for (int i = 0; i < ndim; ++i) {
     int64_t minimum = arith::ConstIntBound::kPosInf;
     int64_t maximum = arith::ConstIntBound::kNegInf;
     for (int j = 0; j < n_indices; ++j) {
-      arith::ConstIntBound bound = analyzer->const_int_bound(multi_indices[j][i]);
-      minimum = std::min(minimum, bound->min_value);
-      maximum = std::max(maximum, bound->max_value);
+      minimum = std::min(minimum, bounds[j][i].first);
+      maximum = std::max(maximum, bounds[j][i].second);
     }
     *numel *= maximum - minimum + 1;
     access_shape[i] = maximum - minimum + 1;
@@ -214,31 +212,6 @@ int64_t GetVarStride(const std::vector<MultiIndex>& multi_indices, const IntVec&
   return (result == kNotFound) ? 0 : result;
 }
 
-/*!
- * \brief Converts a 2-dimensional STL vector to a TVM NDArray
- * \param src The source 2-dimensional STL vector
- * \param second_dim_size The length of the second dimension. When the first dim of src is 0,
- * second_dim_size must be specified, and in such case the shape of the result NDArray is
- * (0, second_dim_size).
- * \return The converted TVM NDArray
- */
-runtime::NDArray AsNDArray(const std::vector<std::vector<double>>& src, int second_dim_size = -1) {
-  int n = src.size();
-  ICHECK(!src.empty() || second_dim_size != -1);
-  int m = src.empty() ? second_dim_size : src[0].size();
-  runtime::NDArray tgt = runtime::NDArray::Empty(
-      /*shape=*/{n, m},
-      /*dtype=*/DLDataType{kDLFloat, 64, 1},
-      /*ctx=*/DLDevice{kDLCPU, 0});
-  double* data = static_cast<double*>(tgt->data);
-  for (const std::vector<double>& row : src) {
-    for (double v : row) {
-      *data++ = v;
-    }
-  }
-  return tgt;
-}
-
 }  // namespace utils
 
 namespace transform {
@@ -828,19 +801,66 @@ void Feature::SetRegion(const LoopNest& loop_nest, IntVec* for_touched_bytes,
     }
     return;
   }
-  // Step 3. Gradually bind the loops from inner to outer,
+  // Step 3. Find the loops each index depends on. Relaxing a loop only changes the bounds of the
+  // indices using its loop variable, so the bounds of the others are reused from the inner loops.
+  std::unordered_map<const VarNode*, int> loop_ids;
+  for (int i = 0; i < n_loops; ++i) {
+    loop_ids[loops[i]->loop_var.get()] = i;
+  }
+  int n_features = sub_features.size();
+  // bounds[k][j][d] is the bound of the d-th dimension of the j-th index of the k-th buffer
+  std::vector<std::vector<std::vector<std::pair<int64_t, int64_t>>>> bounds(n_features);
+  // dependents[i] lists the (k, j, d) whose index uses the loop variable of loops[i]
+  std::vector<std::vector<std::array<int, 3>>> dependents(n_loops);
+  for (int k = 0; k < n_features; ++k) {
+    const std::vector<MultiIndex>& multi_indices = sub_features[k].multi_indices;
+    bounds[k].resize(multi_indices.size());
+    for (int j = 0, n_indices = multi_indices.size(); j < n_indices; ++j) {
+      bounds[k][j].resize(multi_indices[j].size());
+      for (int d = 0, ndim = multi_indices[j].size(); d < ndim; ++d) {
+        std::unordered_set<int> used;
+        PostOrderVisit(multi_indices[j][d], [&](const ObjectRef& obj) {
+          if (const VarNode* var = obj.as<VarNode>()) {
+            auto it = loop_ids.find(var);
+            if (it != loop_ids.end() && used.insert(it->second).second) {
+              dependents[it->second].push_back({k, j, d});
+            }
+          }
+        });
+      }
+    }
+  }
+  auto f_update_bound = [&](int k, int j, int d) {
+    arith::ConstIntBound bound = analyzer->const_int_bound(sub_features[k].multi_indices[j][d]);
+    bounds[k][j][d] = {bound->min_value, bound->max_value};
+  };
+  // Step 4. Gradually bind the loops from inner to outer,
   // calculate the area the loops touch on each buffer
   for (int i = n_loops - 1; i >= 0; --i) {
     const ForNode* loop = loops[i];
     analyzer->Bind(loop->loop_var, Range::FromMinExtent(loop->min, loop->extent),
                    /*allow_override=*/true);
+    if (i == n_loops - 1) {
+      for (int k = 0; k < n_features; ++k) {
+        for (int j = 0, n_indices = bounds[k].size(); j < n_indices; ++j) {
+          for (int d = 0, ndim = bounds[k][j].size(); d < ndim; ++d) {
+            f_update_bound(k, j, d);
+          }
+        }
+      }
+    } else {
+      for (const std::array<int, 3>& kjd : dependents[i]) {
+        f_update_bound(kjd[0], kjd[1], kjd[2]);
+      }
+    }
     int64_t& touched_bytes = (*for_touched_bytes)[i] = 0;
-    for (SubFeature& feature : sub_features) {
+    for (int k = 0; k < n_features; ++k) {
+      SubFeature& feature = sub_features[k];
       const BufferNode* buffer = feature.buffer;
       // Note: `feature.access_shape` for `i == 0` is the only one preserved,
       // while others are discarded
       int64_t numel;
-      feature.access_shape = utils::RelaxAndUnion(feature.multi_indices, &numel, analyzer);
+      feature.access_shape = utils::UnionBounds(bounds[k], &numel);
       numel = std::max<int64_t>(0, numel);
       feature.loop_accessed_numel[i][buffer] = numel;
       touched_bytes += numel * buffer->dtype.bytes();
@@ -1371,23 +1391,40 @@ class PerStoreFeatureNode : public FeatureExtractorNode {
     v->Visit("feature_vector_length", &feature_vector_length);
   }
 
-  void ExtractSingle(IRModule mod, bool is_gpu, std::vector<std::vector<double>>* results) {
+  /*!
+   * \brief Extract the features of a module into a (num_stores, feature_vector_length) array.
+   * \param mod The module.
+   * \param is_gpu Whether the target is a GPU.
+   * \param workload_feature The workload features shared by all the stores, or empty.
+   * \return The features.
+   */
+  runtime::NDArray ExtractSingle(IRModule mod, bool is_gpu,
+                                 const std::vector<double>& workload_feature) {
     static transform::Sequential passes = tir::transform::PassListForPerStoreFeature();
     mod = passes(std::move(mod));
     std::vector<tir::Feature> features = tir::PerStoreFeatureCollector::Collect(
         is_gpu, this->cache_line_bytes, this->arith_intensity_curve_num_samples, mod);
-    int n_features = features.size();
-    results->resize(n_features);
-    for (int i = 0; i < n_features; ++i) {
-      const tir::Feature& feature = features[i];
-      std::vector<double>& result = (*results)[i];
-      result.reserve(feature_vector_length);
-      feature.group1->Export(&result);
-      feature.group2->Export(&result, this->buffers_per_store);
-      feature.group3->Export(&result);
-      feature.group4->Export(&result, feature.group5->outer_prod);
-      feature.group5->Export(&result);
+    int64_t n_features = features.size();
+    runtime::NDArray result = runtime::NDArray::Empty(
+        /*shape=*/{n_features, feature_vector_length},
+        /*dtype=*/DLDataType{kDLFloat, 64, 1},
+        /*ctx=*/DLDevice{kDLCPU, 0});
+    double* data = static_cast<double*>(result->data);
+    // The rows are exported into one buffer and copied into the result one by one
+    std::vector<double> row;
+    row.reserve(feature_vector_length);
+    for (const tir::Feature& feature : features) {
+      row.clear();
+      feature.group1->Export(&row);
+      feature.group2->Export(&row, this->buffers_per_store);
+      feature.group3->Export(&row);
+      feature.group4->Export(&row, feature.group5->outer_prod);
+      feature.group5->Export(&row);
+      row.insert(row.end(), workload_feature.begin(), workload_feature.end());
+      ICHECK_EQ(static_cast<int>(row.size()), feature_vector_length);
+      data = std::copy(row.begin(), row.end(), data);
     }
+    return result;
   }
 
   Array<runtime::NDArray> ExtractFrom(const TuneContext& tune_context,
@@ -1395,20 +1432,14 @@ class PerStoreFeatureNode : public FeatureExtractorNode {
     bool is_gpu = tune_context->target.value()->kind->name == "cuda";
     std::vector<runtime::NDArray> results;
     results.resize(candidates.size());
-    std::unique_ptr<tir::group6::Feature> feature_group6 = nullptr;
+    std::vector<double> workload_feature;
     if (extract_workload) {
-      feature_group6 = std::make_unique<tir::group6::Feature>(tune_context->mod.value());
+      tir::group6::Feature(tune_context->mod.value()).Export(&workload_feature);
     }
-    auto f = [this, is_gpu, &feature_group6, &candidates, &results](int, int task_id) -> void {
+    auto f = [this, is_gpu, &workload_feature, &candidates, &results](int, int task_id) -> void {
       const auto& candidate = candidates[task_id];
-      std::vector<std::vector<double>> features;
-      ExtractSingle(DeepCopyIRModule(candidate->sch->mod()), is_gpu, &features);
-      if (extract_workload) {
-        for (auto& feature : features) {
-          feature_group6->Export(&feature);
-        }
-      }
-      results[task_id] = tir::utils::AsNDArray(features, this->feature_vector_length);
+      results[task_id] =
+          ExtractSingle(DeepCopyIRModule(candidate->sch->mod()), is_gpu, workload_feature);
     };
     support::parallel_for_dynamic(0, candidates.size(), tune_context->num_threads, f);
     return results;
@@ -0,0 +1,137 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <chrono>
+#include <future>
+
+#include "../utils.h"
+#include "../worker_pool.h"
+
+namespace tvm {
+namespace meta_schedule {
+
+/*! \brief The runner that dispatches the measurements to a pool of worker daemons. */
+class WorkerPoolRunnerNode final : public RunnerNode {
+ public:
+  /*! \brief The addresses of the workers. */
+  Array<String> workers;
+  /*! \brief The number of times to run the function for taking average. */
+  int number;
+  /*! \brief The number of times to repeat the measurement. */
+  int repeat;
+  /*! \brief The minimum duration of one `repeat` in milliseconds. */
+  int min_repeat_ms;
+  /*! \brief Whether to flush the cache on CPU. */
+  bool enable_cpu_cache_flush;
+  /*! \brief The timeout of each measurement in seconds. */
+  double timeout_sec;
+  /*! \brief The time without heartbeat after which a worker is considered dead. */
+  double heartbeat_timeout_sec;
+  /*! \brief The maximal number of times a measurement is re-dispatched after worker failures. */
+  int max_retries;
+
+  /*! \brief The connections to the workers. */
+  std::shared_ptr<WorkerPool> pool_;
+
+  void VisitAttrs(tvm::AttrVisitor* v) {
+    v->Visit("workers", &workers);
+    v->Visit("number", &number);
+    v->Visit("repeat", &repeat);
+    v->Visit("min_repeat_ms", &min_repeat_ms);
+    v->Visit("enable_cpu_cache_flush", &enable_cpu_cache_flush);
+    v->Visit("timeout_sec", &timeout_sec);
+    v->Visit("heartbeat_timeout_sec", &heartbeat_timeout_sec);
+    v->Visit("max_retries", &max_retries);
+    // `pool_` is not visited
+  }
+
+  static constexpr const char* _type_key = "meta_schedule.WorkerPoolRunner";
+  TVM_DECLARE_FINAL_OBJECT_INFO(WorkerPoolRunnerNode, RunnerNode);
+
+ public:
+  Array<RunnerFuture> Run(Array<RunnerInput> runner_inputs) final {
+    int n = runner_inputs.size();
+    Array<Integer> evaluator_config{number, repeat, min_repeat_ms,
+                                    static_cast<int>(enable_cpu_cache_flush)};
+    std::vector<std::string> payloads;
+    payloads.reserve(n);
+    for (const RunnerInput& input : runner_inputs) {
+      Array<ObjectRef> args_info;
+      args_info.reserve(input->args_info.size());
+      for (const ArgInfo& arg_info : input->args_info) {
+        args_info.push_back(arg_info->AsJSON());
+      }
+      payloads.push_back(SaveJSON(Array<ObjectRef>{input->artifact_path, input->device_type,
+                                                   args_info, evaluator_config}));
+    }
+    // The whole batch runs in the background, while the futures share its results
+    std::shared_future<std::vector<WorkerPool::Result>> batch =
+        std::async(std::launch::async, [pool = pool_, payloads = std::move(payloads)]() {
+          return pool->Run("run", payloads);
+        }).share();
+    Array<RunnerFuture> futures;
+    futures.reserve(n);
+    for (int i = 0; i < n; ++i) {
+      futures.push_back(RunnerFuture(
+          /*f_done=*/
+          [batch]() -> bool {
+            return batch.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+          },
+          /*f_result=*/
+          [batch, i]() -> RunnerResult {
+            const WorkerPool::Result& result = batch.get()[i];
+            if (!result.ok) {
+              return RunnerResult(NullOpt, String(result.payload));
+            }
+            // The costs in seconds, separated by commas
+            Array<FloatImm> run_secs;
+            std::istringstream is(result.payload);
+            for (std::string cost; std::getline(is, cost, ',');) {
+              run_secs.push_back(FloatImm(DataType::Float(64), std::stod(cost)));
+            }
+            return RunnerResult(run_secs, NullOpt);
+          }));
+    }
+    return futures;
+  }
+};
+
+Runner Runner::WorkerPoolRunner(Array<String> workers, int number, int repeat, int min_repeat_ms,
+                                bool enable_cpu_cache_flush, double timeout_sec,
+                                double heartbeat_timeout_sec, int max_retries) {
+  ObjectPtr<WorkerPoolRunnerNode> n = make_object<WorkerPoolRunnerNode>();
+  n->pool_ =
+      std::make_shared<WorkerPool>(workers, timeout_sec, heartbeat_timeout_sec, max_retries);
+  n->workers = std::move(workers);
+  n->number = number;
+  n->repeat = repeat;
+  n->min_repeat_ms = min_repeat_ms;
+  n->enable_cpu_cache_flush = enable_cpu_cache_flush;
+  n->timeout_sec = timeout_sec;
+  n->heartbeat_timeout_sec = heartbeat_timeout_sec;
+  n->max_retries = max_retries;
+  return Runner(std::move(n));
+}
+
+TVM_REGISTER_NODE_TYPE(WorkerPoolRunnerNode);
+TVM_REGISTER_GLOBAL("meta_schedule.RunnerWorkerPoolRunner")
+    .set_body_typed(Runner::WorkerPoolRunner);
+
+}  // namespace meta_schedule
+}  // namespace tvm
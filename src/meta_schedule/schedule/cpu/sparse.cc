@@ -0,0 +1,57 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "../../utils.h"
+
+namespace tvm {
+namespace meta_schedule {
+
+using namespace tvm::tir;
+
+/*!
+ * \brief Schedule the block computation of a BSR sparse dense, i.e. `sparse_dense` with a
+ * sparse weight, which is annotated by TOPI with `schedule_rule = "sparse_dense_bsr"`.
+ *
+ * The block loops are (i, nb_j, j, elem_idx, c), where the extent of the reduction loop
+ * `elem_idx` depends on `nb_j` through the weight indptr, so the loops can neither be
+ * tiled nor reordered by the generic rules. The rows of the data are tiled with a sampled
+ * factor so a tile of rows shares each weight block load, the block rows are parallelized
+ * and the rows of a weight block (`j`) are vectorized.
+ */
+TVM_REGISTER_GLOBAL("meta_schedule.cpu.sparse_dense_bsr")
+    .set_body_typed([](Schedule sch, BlockRV block) -> Array<Schedule> {
+      Array<LoopRV> loops = sch->GetLoops(block);
+      ICHECK_EQ(loops.size(), 5);
+      const LoopRV& i = loops[0];
+      const LoopRV& nb_j = loops[1];
+      const LoopRV& j = loops[2];
+      const LoopRV& elem_idx = loops[3];
+      const LoopRV& c = loops[4];
+      Array<ExprRV> factors = sch->SamplePerfectTile(i, /*n=*/2, /*max_innermost_factor=*/16);
+      Array<LoopRV> i_tiles = sch->Split(i, {factors.begin(), factors.end()});
+      ICHECK_EQ(i_tiles.size(), 2);
+      sch->Reorder({nb_j, i_tiles[0], elem_idx, c, i_tiles[1], j});
+      sch->Parallel(nb_j);
+      sch->Unroll(i_tiles[1]);
+      sch->Vectorize(j);
+      return {sch};
+    });
+
+}  // namespace meta_schedule
+}  // namespace tvm
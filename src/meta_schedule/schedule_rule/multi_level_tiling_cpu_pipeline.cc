@@ -0,0 +1,138 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "../../tir/schedule/analysis.h"
+#include "../../tir/schedule/transform.h"
+#include "../utils.h"
+#include "multi_level_tiling.h"
+
+namespace tvm {
+namespace meta_schedule {
+
+using tir::BlockRV;
+using tir::LoopRV;
+using tir::Schedule;
+
+/*!
+ * \brief Extension of MultiLevelTiling for CPU that software-pipelines the read caches.
+ * The copies into the read caches of the next tile are overlapped with the compute on the current
+ * tile, and the source regions of the following tiles are optionally prefetched.
+ */
+class MultiLevelTilingCPUPipelineNode : public MultiLevelTilingNode {
+ public:
+  /*! \brief The candidate prefetch distances in tiles, where 0 means no prefetching. */
+  Array<Integer> prefetch_distances;
+
+  void VisitAttrs(tvm::AttrVisitor* v) {
+    MultiLevelTilingNode::VisitAttrs(v);
+    v->Visit("prefetch_distances", &prefetch_distances);
+  }
+
+  static constexpr const char* _type_key = "meta_schedule.MultiLevelTilingCPUPipeline";
+  TVM_DECLARE_FINAL_OBJECT_INFO(MultiLevelTilingCPUPipelineNode, MultiLevelTilingNode);
+
+ protected:
+  ScheduleRule Clone() const final {
+    ObjectPtr<MultiLevelTilingCPUPipelineNode> n =
+        make_object<MultiLevelTilingCPUPipelineNode>(*this);
+    return ScheduleRule(n);
+  }
+
+  std::vector<State> ApplySubRules(std::vector<State> states) final {
+    states = MultiLevelTilingNode::ApplySubRules(std::move(states));
+    states = SubRule(std::move(states), [&](State state) { return AddCPUPipeline(state); });
+    return states;
+  }
+
+  /*! \brief Pipeline the loop that the read caches are computed at. */
+  std::vector<State> AddCPUPipeline(State state) const;
+};
+
+std::vector<State> MultiLevelTilingCPUPipelineNode::AddCPUPipeline(State state) const {
+  if (state->read_reuse.empty()) {
+    return {state};
+  }
+  const Schedule& sch = state->sch;
+  // Find the loop whose body consists of the read caches followed by the compute.
+  const BlockRV& cache_rv = state->read_reuse.begin()->second;
+  tir::StmtSRef cache_sref = sch->GetSRef(cache_rv);
+  Optional<LoopRV> pipeline_loop = NullOpt;
+  const tir::SeqStmtNode* seq = nullptr;
+  for (const LoopRV& loop_rv : sch->GetLoops(cache_rv)) {
+    const tir::ForNode* loop = TVM_SREF_TO_FOR(sch->GetSRef(loop_rv));
+    if (const auto* body = loop->body.as<tir::SeqStmtNode>()) {
+      pipeline_loop = loop_rv;
+      seq = body;
+    }
+  }
+  if (!pipeline_loop.defined() || seq->size() != state->read_reuse.size() + 1) {
+    return {state};
+  }
+  const tir::ForNode* loop = TVM_SREF_TO_FOR(sch->GetSRef(pipeline_loop.value()));
+  const int64_t* extent = tir::GetLoopIntExtent(loop);
+  if (loop->kind != tir::ForKind::kSerial || extent == nullptr || *extent < 2 ||
+      !loop->annotations.empty()) {
+    return {state};
+  }
+  for (const tir::Stmt& stmt : seq->seq) {
+    if (!stmt->IsInstance<tir::ForNode>() && !stmt->IsInstance<tir::BlockRealizeNode>()) {
+      return {state};
+    }
+  }
+  // The read caches of the next tile form stage 0, the compute on the current tile stage 1.
+  int n = seq->size();
+  Array<Integer> stages(n - 1, Integer(0));
+  stages.push_back(Integer(1));
+  Array<Integer> orders;
+  for (int i = 0; i < n; ++i) {
+    orders.push_back(Integer(i));
+  }
+  std::vector<State> results{state};
+  for (const Integer& distance : prefetch_distances) {
+    State new_state = state->Copy();
+    const LoopRV& loop_rv = pipeline_loop.value();
+    new_state->sch->Annotate(loop_rv, tir::attr::software_pipeline_stage, stages);
+    new_state->sch->Annotate(loop_rv, tir::attr::software_pipeline_order, orders);
+    if (distance->value > 0) {
+      new_state->sch->Annotate(loop_rv, tir::attr::software_pipeline_prefetch, distance);
+    }
+    results.push_back(std::move(new_state));
+  }
+  return results;
+}
+
+ScheduleRule ScheduleRule::MultiLevelTilingCPUPipeline(
+    String structure, Optional<Integer> max_innermost_factor,
+    Optional<Map<String, ObjectRef>> reuse_read, Optional<Map<String, ObjectRef>> reuse_write,
+    Array<Integer> prefetch_distances) {
+  auto node = MultiLevelTilingInitCommon<MultiLevelTilingCPUPipelineNode>(
+      structure, NullOpt, max_innermost_factor, NullOpt, reuse_read, reuse_write);
+  for (const Integer& distance : prefetch_distances) {
+    CHECK_GE(distance->value, 0) << "ValueError: prefetch distances must be non-negative";
+  }
+  node->prefetch_distances = prefetch_distances;
+  return ScheduleRule(node);
+}
+
+TVM_REGISTER_NODE_TYPE(MultiLevelTilingCPUPipelineNode);
+TVM_REGISTER_GLOBAL("meta_schedule.ScheduleRuleMultiLevelTilingCPUPipeline")
+    .set_body_typed(ScheduleRule::MultiLevelTilingCPUPipeline);
+
+}  // namespace meta_schedule
+}  // namespace tvm
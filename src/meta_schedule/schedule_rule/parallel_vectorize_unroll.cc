@@ -18,22 +18,6 @@
  */
 #include "../utils.h"
 
-namespace tvm {
-namespace tir {
-
-bool IsRootBlock(const Schedule& sch, const BlockRV& block_rv) {
-  StmtSRef block_sref = sch->GetSRef(block_rv);
-  return block_sref->parent == nullptr;
-}
-
-bool CheckSpatialPrimFunc(const Schedule& sch, const BlockRV& root_block_rv) {
-  return IsSpatialPrimFunc(
-      GetRef<PrimFunc>(GetRootPrimFunc(sch->mod(), sch->Get(root_block_rv).get(), nullptr)));
-}
-
-}  // namespace tir
-}  // namespace tvm
-
 namespace tvm {
 namespace meta_schedule {
 
@@ -87,8 +87,23 @@ Array<ScheduleRule> ScheduleRule::DefaultLLVM() {
 
 Array<ScheduleRule> ScheduleRule::DefaultX86(const String& type) {
   static const Map<String, String> intrins = {{"vnni", "dot_16x4_vnni"},
-                                              {"avx512", "dot_16x4_avx512"}};
-  return {
+                                              {"avx512", "dot_16x4_avx512"},
+                                              {"avxvnni", "dot_8x4_avxvnni"},
+                                              {"amx", "dot_16x16x64_amx"}};
+  auto tiling_with_intrin = [](const String& intrin_name) {
+    return ScheduleRule::MultiLevelTilingWithIntrin(
+        /*intrin_name=*/intrin_name,
+        /*structure=*/"SSRSRS",
+        /*tile_binds=*/NullOpt,
+        /*max_innermost_factor=*/Integer(64),
+        /*vector_load_lens=*/NullOpt,
+        /*reuse_read=*/NullOpt,
+        /*reuse_write=*/
+        Map<String, ObjectRef>{{"req", String("may")},
+                               {"levels", Array<Integer>{1, 2}},
+                               {"scope", String("global")}});
+  };
+  Array<ScheduleRule> rules{
       ScheduleRule::ApplyCustomRule(),
       ScheduleRule::InlineConstantScalars(),
       ScheduleRule::AutoInline(
@@ -102,34 +117,30 @@ Array<ScheduleRule> ScheduleRule::DefaultX86(const String& type) {
       ScheduleRule::AddRFactor(
           /*max_jobs_per_core=*/16,
           /*max_innermost_factor=*/Integer(64)),
-      ScheduleRule::MultiLevelTilingWithIntrin(
-          /*intrin_name=*/intrins[type],
-          /*structure=*/"SSRSRS",
-          /*tile_binds=*/NullOpt,
-          /*max_innermost_factor=*/Integer(64),
-          /*vector_load_lens=*/NullOpt,
-          /*reuse_read=*/NullOpt,
-          /*reuse_write=*/
-          Map<String, ObjectRef>{{"req", String("may")},
-                                 {"levels", Array<Integer>{1, 2}},
-                                 {"scope", String("global")}}),
-      ScheduleRule::MultiLevelTiling(
-          /*structure=*/"SSRSRS",
-          /*tile_binds=*/NullOpt,
-          /*max_innermost_factor=*/Integer(64),
-          /*vector_load_lens=*/NullOpt,
-          /*reuse_read=*/NullOpt,
-          /*reuse_write=*/
-          Map<String, ObjectRef>{{"req", String("may")},
-                                 {"levels", Array<Integer>{1, 2}},
-                                 {"scope", String("global")}}),
-      ScheduleRule::ParallelizeVectorizeUnroll(
-          /*max_jobs_per_core=*/16,
-          /*max_vectorize_extent=*/64,
-          /*unroll_max_steps=*/Array<Integer>{0, 16, 64, 512},
-          /*unroll_explicit=*/true),
-      ScheduleRule::RandomComputeLocation(),
+      tiling_with_intrin(intrins[type]),
   };
+  if (type == "amx") {
+    // Every AMX machine also has AVX512-VNNI, which tensorizes the int8 dense and conv2d shapes
+    // the 16x16x64 tile does not divide.
+    rules.push_back(tiling_with_intrin(intrins["vnni"]));
+  }
+  rules.push_back(ScheduleRule::MultiLevelTiling(
+      /*structure=*/"SSRSRS",
+      /*tile_binds=*/NullOpt,
+      /*max_innermost_factor=*/Integer(64),
+      /*vector_load_lens=*/NullOpt,
+      /*reuse_read=*/NullOpt,
+      /*reuse_write=*/
+      Map<String, ObjectRef>{{"req", String("may")},
+                             {"levels", Array<Integer>{1, 2}},
+                             {"scope", String("global")}}));
+  rules.push_back(ScheduleRule::ParallelizeVectorizeUnroll(
+      /*max_jobs_per_core=*/16,
+      /*max_vectorize_extent=*/64,
+      /*unroll_max_steps=*/Array<Integer>{0, 16, 64, 512},
+      /*unroll_explicit=*/true));
+  rules.push_back(ScheduleRule::RandomComputeLocation());
+  return rules;
 }
 
 Array<ScheduleRule> ScheduleRule::DefaultCUDA() {
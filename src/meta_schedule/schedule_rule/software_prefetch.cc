@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "../utils.h"
+
+namespace tvm {
+namespace tir {
+
+/*! \brief Whether the PrimFunc has a load whose index is itself loaded from memory. */
+static bool HasIndirectLoad(const Schedule& sch, const BlockRV& root_block_rv) {
+  const PrimFuncNode* func = GetRootPrimFunc(sch->mod(), sch->Get(root_block_rv).get(), nullptr);
+  bool found = false;
+  PostOrderVisit(func->body, [&found](const ObjectRef& node) {
+    if (const auto* load = node.as<BufferLoadNode>()) {
+      for (const PrimExpr& index : load->indices) {
+        PostOrderVisit(index, [&found](const ObjectRef& sub) {
+          found = found || sub->IsInstance<BufferLoadNode>();
+        });
+      }
+    }
+  });
+  return found;
+}
+
+}  // namespace tir
+}  // namespace tvm
+
+namespace tvm {
+namespace meta_schedule {
+
+class SoftwarePrefetchNode : public ScheduleRuleNode {
+ public:
+  // Inherited from ScheduleRuleNode
+  void InitializeWithTuneContext(const TuneContext& context) final {}
+
+  // Inherited from ScheduleRuleNode
+  Array<tir::Schedule> Apply(const tir::Schedule& sch, const tir::BlockRV& root_rv) {
+    // Only mark the root block, for the workloads that are likely to benefit from prefetching:
+    // the ones with indirect loads, and the ones with reductions that stream strided operands.
+    if (!tir::IsRootBlock(sch, root_rv) || prefetch_distances.empty()) {
+      return {sch};
+    }
+    if (!tir::HasIndirectLoad(sch, root_rv) && tir::CheckSpatialPrimFunc(sch, root_rv)) {
+      return {sch};
+    }
+    int n = prefetch_distances.size();
+    Array<FloatImm> probs(n, FloatImm(DataType::Float(64), 1.0 / n));
+    PrimExpr distance = sch->SampleCategorical(prefetch_distances, probs);
+    sch->Annotate(root_rv, tir::attr::pragma_software_prefetch, distance);
+    return {sch};
+  }
+
+  // Inherited from ScheduleRuleNode
+  ScheduleRule Clone() const final {
+    ObjectPtr<SoftwarePrefetchNode> n = make_object<SoftwarePrefetchNode>(*this);
+    return ScheduleRule(n);
+  }
+
+ public:
+  /*!
+   * \brief The candidates of the number of iterations to prefetch ahead, where 0 disables
+   * prefetching.
+   */
+  Array<Integer> prefetch_distances;
+
+  void VisitAttrs(tvm::AttrVisitor* v) { v->Visit("prefetch_distances", &prefetch_distances); }
+
+  static constexpr const char* _type_key = "meta_schedule.SoftwarePrefetch";
+  TVM_DECLARE_FINAL_OBJECT_INFO(SoftwarePrefetchNode, ScheduleRuleNode);
+};
+
+ScheduleRule ScheduleRule::SoftwarePrefetch(Array<Integer> prefetch_distances) {
+  ObjectPtr<SoftwarePrefetchNode> n = make_object<SoftwarePrefetchNode>();
+  n->prefetch_distances = prefetch_distances;
+  return ScheduleRule(n);
+}
+
+TVM_REGISTER_NODE_TYPE(SoftwarePrefetchNode);
+TVM_REGISTER_GLOBAL("meta_schedule.ScheduleRuleSoftwarePrefetch")
+    .set_body_typed(ScheduleRule::SoftwarePrefetch);
+
+}  // namespace meta_schedule
+}  // namespace tvm
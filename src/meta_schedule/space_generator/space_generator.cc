@@ -28,10 +28,17 @@ String GetRuleKindFromTarget(const Target& target) {
         runtime::Registry::Get("target.llvm_x86_has_feature");
     ICHECK(llvm_x86_has_feature_fn_ptr != nullptr)
         << "The `target.llvm_x86_has_feature` func is not in tvm registry.";
+    bool have_amx_int8 = (*llvm_x86_has_feature_fn_ptr)("amx-int8", target);
+    bool have_amx_tile = (*llvm_x86_has_feature_fn_ptr)("amx-tile", target);
     bool have_avx512vnni = (*llvm_x86_has_feature_fn_ptr)("avx512vnni", target);
     bool have_avxvnni = (*llvm_x86_has_feature_fn_ptr)("avxvnni", target);
-    if (have_avx512vnni || have_avxvnni) {
+    if (have_amx_int8 && have_amx_tile) {
+      return "amx";
+    } else if (have_avx512vnni) {
       return "vnni";
+    } else if (have_avxvnni) {
+      // AVX-VNNI only provides the 256-bit (VEX-encoded) vpdpbusd
+      return "avxvnni";
     } else {
       // avx512f:  llvm.x86.avx512.addpd.w.512 (LLVM auto, added)
       // avx512bw: llvm.x86.avx512.pmaddubs.w.512" (TVM required)
@@ -116,6 +123,14 @@ void SpaceGeneratorNode::InitializeWithTuneContext(const TuneContext& context) {
       default_sch_rules = ScheduleRule::DefaultX86("vnni");
       default_postprocs = Postproc::DefaultCPUTensorization();
       default_mutator_probs = Mutator::DefaultLLVM();
+    } else if (kind == "avxvnni") {
+      default_sch_rules = ScheduleRule::DefaultX86("avxvnni");
+      default_postprocs = Postproc::DefaultCPUTensorization();
+      default_mutator_probs = Mutator::DefaultLLVM();
+    } else if (kind == "amx") {
+      default_sch_rules = ScheduleRule::DefaultX86("amx");
+      default_postprocs = Postproc::DefaultCPUTensorization();
+      default_mutator_probs = Mutator::DefaultLLVM();
     } else if (kind == "avx512") {
       default_sch_rules = ScheduleRule::DefaultX86("avx512");
       default_postprocs = Postproc::DefaultCPUTensorization();
@@ -0,0 +1,304 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "../trace_apply.h"
+#include "../utils.h"
+
+namespace tvm {
+namespace meta_schedule {
+
+/*!
+ * \brief The gradient based task scheduler with convergence detection and warm start.
+ * A task is stopped once its best latency improves by less than `min_improvement` within the
+ * last `patience` rounds, so that the rest of the global trial budget goes to the tasks that
+ * still improve, ranked by the weighted gradient as in GradientBased.
+ * Before its first search round, a task without records in the database measures the best
+ * traces of the `warm_start_top_k` nearest tuned workloads, transplanted by
+ * ScheduleUsingAnchorTrace. The measured results land in the database, where the search
+ * strategy picks them up as its initial population.
+ */
+class ConvergenceAwareNode final : public TaskSchedulerNode {
+ public:
+  double alpha;
+  int window_size;
+  int patience;
+  double min_improvement;
+  int warm_start_top_k;
+  support::LinearCongruentialEngine::TRandState rand_state;
+
+  int round_robin_rounds_;
+  std::vector<std::vector<double>> best_latency_history_;
+  std::vector<bool> converged_;
+  std::vector<bool> warm_started_;
+  /*! \brief The best record and the FLOP count of each tuned workload in the database */
+  std::vector<std::pair<TuningRecord, double>> warm_start_pool_;
+
+  void VisitAttrs(tvm::AttrVisitor* v) {
+    TaskSchedulerNode::VisitAttrs(v);
+    v->Visit("alpha", &alpha);
+    v->Visit("window_size", &window_size);
+    v->Visit("patience", &patience);
+    v->Visit("min_improvement", &min_improvement);
+    v->Visit("warm_start_top_k", &warm_start_top_k);
+    // `rand_state` is not visited.
+    // `round_robin_rounds_` is not visited.
+    // `best_latency_history_` is not visited.
+    // `converged_` is not visited.
+    // `warm_started_` is not visited.
+    // `warm_start_pool_` is not visited.
+  }
+
+  static constexpr const char* _type_key = "meta_schedule.ConvergenceAware";
+  TVM_DECLARE_FINAL_OBJECT_INFO(ConvergenceAwareNode, TaskSchedulerNode);
+
+ public:
+  void Tune(Array<TuneContext> tasks, Array<FloatImm> task_weights, int max_trials_global,
+            int max_trials_per_task, int num_trials_per_iter, Builder builder, Runner runner,
+            Array<MeasureCallback> measure_callbacks, Optional<Database> database,
+            Optional<CostModel> cost_model) final {
+    int n_tasks = tasks.size();
+    round_robin_rounds_ = 0;
+    best_latency_history_.assign(n_tasks, std::vector<double>());
+    converged_.assign(n_tasks, false);
+    warm_started_.assign(n_tasks, false);
+    warm_start_pool_.clear();
+    if (warm_start_top_k > 0 && database.defined()) {
+      CollectWarmStartPool(database.value());
+    }
+    TaskSchedulerNode::Tune(tasks, task_weights, max_trials_global, max_trials_per_task,
+                            num_trials_per_iter, builder, runner, measure_callbacks, database,
+                            cost_model);
+    warm_start_pool_.clear();
+  }
+
+  int NextTaskId() final {
+    int n_tasks = this->tasks_.size();
+    // Step 1. Check if it's in round robin mode.
+    if (round_robin_rounds_ == 0) {
+      TVM_PY_LOG_CLEAR_SCREEN(this->logger);
+      this->PrintTuningStatistics();
+    }
+    if (round_robin_rounds_ < n_tasks) {
+      return round_robin_rounds_++;
+    }
+    if (round_robin_rounds_ == n_tasks) {
+      for (int i = 0; i < n_tasks; ++i) {
+        if (this->tasks_[i]->runner_futures.defined()) {
+          this->JoinRunningTask(i);
+        }
+      }
+      ++round_robin_rounds_;
+    }
+    for (;;) {
+      // Step 2. Stop the converged tasks and collect the tasks that are not terminated yet
+      std::vector<int> tasks_alive;
+      tasks_alive.reserve(n_tasks);
+      for (int i = 0; i < n_tasks; ++i) {
+        this->TouchTask(i);
+        TaskRecordNode* task = this->tasks_[i].get();
+        if (!task->is_terminated && converged_[i] && !task->runner_futures.defined()) {
+          this->TerminateTask(i);
+        }
+        if (!task->is_terminated) {
+          tasks_alive.push_back(i);
+        }
+      }
+      if (tasks_alive.empty()) {
+        return -1;
+      }
+      // Step 3. Select the task with the largest gradient
+      int task_id = SelectByGradient(tasks_alive);
+      // Step 4. Join the task, which may find it converged and pick again
+      if (this->tasks_[task_id]->runner_futures.defined()) {
+        JoinRunningTask(task_id);
+      }
+      if (!converged_[task_id]) {
+        return task_id;
+      }
+    }
+  }
+
+  Array<RunnerResult> JoinRunningTask(int task_id) final {
+    Array<RunnerResult> results = TaskSchedulerNode::JoinRunningTask(task_id);
+    TaskRecordNode* task = this->tasks_[task_id].get();
+    std::vector<double>& history = this->best_latency_history_.at(task_id);
+    if (task->latency_ms.size() > 0) {
+      history.push_back(*std::min_element(task->latency_ms.begin(),  //
+                                          task->latency_ms.end()));
+    }
+    // The task is terminated in `NextTaskId`, since `Tune` terminates the joined tasks at the end
+    int n = history.size();
+    if (patience > 0 && n > patience && history[n - 1] < 1e9) {
+      double before = history[n - 1 - patience];
+      double best = history[n - 1];
+      if (before - best <= min_improvement * before) {
+        converged_[task_id] = true;
+        TVM_PY_LOG(INFO, this->logger)
+            << "Task #" << task_id << " has converged: the best latency improves by less than "
+            << min_improvement * 100 << "% in the last " << patience << " round(s)";
+      }
+    }
+    return results;
+  }
+
+  Optional<Array<MeasureCandidate>> GenerateMeasureCandidates(int task_id) final {
+    if (!warm_started_[task_id]) {
+      warm_started_[task_id] = true;
+      Array<MeasureCandidate> candidates = WarmStartCandidates(task_id);
+      if (!candidates.empty()) {
+        TVM_PY_LOG(INFO, this->logger) << "Warm-starting Task #" << task_id << " with "
+                                       << candidates.size() << " transplanted trace(s)";
+        return candidates;
+      }
+    }
+    return TaskSchedulerNode::GenerateMeasureCandidates(task_id);
+  }
+
+ private:
+  /*! \brief Select the alive task with the largest weighted gradient, see GradientBased. */
+  int SelectByGradient(const std::vector<int>& tasks_alive) {
+    std::vector<double> grad;
+    grad.reserve(tasks_alive.size());
+    for (int task_id : tasks_alive) {
+      const std::vector<double>& best_latency = this->best_latency_history_.at(task_id);
+      int n = best_latency.size();
+      double task_weight = this->tasks_[task_id]->task_weight;
+      int w = this->window_size;
+      if (n > 0 && best_latency[n - 1] < 1e9) {
+        double best = best_latency[n - 1];
+        double g1 = (n >= 1 + w) ? (best_latency[n - 1 - w] - best) / w : 0.0;
+        double g2 = best / n;
+        double g = alpha * g1 + (1 - alpha) * g2;
+        grad.push_back(g * task_weight);
+      } else {
+        // If the best time cost is unavailable, it means some task is not valid. Skip it.
+        grad.push_back(-1e9);
+      }
+    }
+    auto max_grad = std::max_element(grad.begin(), grad.end());
+    auto min_grad = std::min_element(grad.begin(), grad.end());
+    if (*max_grad == *min_grad) {
+      return tasks_alive[tir::SampleInt(&this->rand_state, 0, tasks_alive.size())];
+    }
+    return tasks_alive[std::distance(grad.begin(), max_grad)];
+  }
+
+  /*! \brief Collect the best valid record of each tuned workload in the database. */
+  void CollectWarmStartPool(const Database& database) {
+    auto _ = Profiler::TimedScope("CollectWarmStartPool");
+    std::unordered_map<Workload, std::pair<TuningRecord, double>, ObjectPtrHash, ObjectPtrEqual>
+        best;
+    for (const TuningRecord& record : database->GetAllTuningRecords()) {
+      if (!record->IsValid()) {
+        continue;
+      }
+      double sum = 0.0;
+      for (const FloatImm& sec : record->run_secs.value()) {
+        sum += sec->value;
+      }
+      double mean = sum / record->run_secs.value().size();
+      auto it = best.find(record->workload);
+      if (it == best.end() || mean < it->second.second) {
+        best.insert_or_assign(record->workload, std::make_pair(record, mean));
+      }
+    }
+    warm_start_pool_.reserve(best.size());
+    for (const auto& kv : best) {
+      const TuningRecord& record = kv.second.first;
+      double flop = std::max(1.0, tir::EstimateTIRFlops(record->workload->mod));
+      warm_start_pool_.emplace_back(record, flop);
+    }
+  }
+
+  /*!
+   * \brief Transplant the best traces of the nearest tuned workloads to a new task. Workloads are
+   * compared by their FLOP counts and only those tuned on the same kind of target are considered.
+   */
+  Array<MeasureCandidate> WarmStartCandidates(int task_id) {
+    const TaskRecordNode* task = this->tasks_[task_id].get();
+    const TuneContext& ctx = task->ctx;
+    Array<MeasureCandidate> candidates;
+    if (warm_start_pool_.empty() || this->database_.value()->HasWorkload(ctx->mod.value())) {
+      // The search strategy already starts from the records of the workload itself
+      return candidates;
+    }
+    auto _ = Profiler::TimedScope("WarmStart");
+    const Target& target = ctx->target.value();
+    std::vector<std::pair<double, const TuningRecord*>> nearest;
+    for (const auto& kv : warm_start_pool_) {
+      const TuningRecord& record = kv.first;
+      if (!record->target.defined() ||
+          record->target.value()->kind->name != target->kind->name) {
+        continue;
+      }
+      nearest.emplace_back(std::abs(std::log(kv.second / task->flop)), &record);
+    }
+    int k = std::min<int>(warm_start_top_k, nearest.size());
+    std::partial_sort(nearest.begin(), nearest.begin() + k, nearest.end());
+    for (int i = 0; i < k; ++i) {
+      const TuningRecord& record = *nearest[i].second;
+      tir::Schedule sch = tir::Schedule::Traced(
+          ctx->mod.value(), /*seed=*/ForkSeed(&this->rand_state), /*debug_mask=*/0,
+          /*error_render_level=*/tir::ScheduleErrorRenderLevel::kNone);
+      try {
+        ScheduleUsingAnchorTrace(sch, record->trace, target);
+        bool ok = true;
+        if (Optional<Array<Postproc>> postprocs = ctx->space_generator.value()->postprocs) {
+          for (const Postproc& postproc : postprocs.value()) {
+            if (!(ok = postproc->Apply(sch))) {
+              break;
+            }
+          }
+        }
+        if (ok) {
+          candidates.push_back(
+              MeasureCandidate(sch, ArgInfo::FromEntryFunc(sch->mod(), /*remove_preproc=*/true)));
+        }
+      } catch (const std::runtime_error& e) {  // includes tvm::Error and dmlc::Error
+        // The anchor block of the tuned workload does not match this task, skip it
+      }
+    }
+    return candidates;
+  }
+};
+
+TaskScheduler TaskScheduler::ConvergenceAware(PackedFunc logger, double alpha, int window_size,
+                                              int patience, double min_improvement,
+                                              int warm_start_top_k,
+                                              support::LinearCongruentialEngine::TRandState seed) {
+  CHECK_GE(patience, 0) << "ValueError: `patience` must be non-negative";
+  CHECK_GE(min_improvement, 0.0) << "ValueError: `min_improvement` must be non-negative";
+  CHECK_GE(warm_start_top_k, 0) << "ValueError: `warm_start_top_k` must be non-negative";
+  ObjectPtr<ConvergenceAwareNode> n = make_object<ConvergenceAwareNode>();
+  n->logger = logger;
+  n->alpha = alpha;
+  n->window_size = window_size;
+  n->patience = patience;
+  n->min_improvement = min_improvement;
+  n->warm_start_top_k = warm_start_top_k;
+  n->rand_state = support::LinearCongruentialEngine::NormalizeSeed(seed);
+  return TaskScheduler(n);
+}
+
+TVM_REGISTER_NODE_TYPE(ConvergenceAwareNode);
+TVM_REGISTER_GLOBAL("meta_schedule.TaskSchedulerConvergenceAware")
+    .set_body_typed(TaskScheduler::ConvergenceAware);
+
+}  // namespace meta_schedule
+}  // namespace tvm
@@ -187,7 +187,7 @@ void TaskSchedulerNode::Tune(Array<TuneContext> ctxs, Array<FloatImm> task_weigh
       continue;
     }
     if (Optional<Array<MeasureCandidate>> candidates = task->measure_candidates =
-            task->ctx->search_strategy.value()->GenerateMeasureCandidates()) {
+            GenerateMeasureCandidates(task_id)) {
       int num_candidates = candidates.value().size();
       num_trials_already += num_candidates;
       TVM_PY_LOG(INFO, this->logger) << "Sending " << num_candidates << " sample(s) to builder";
@@ -239,6 +239,10 @@ Array<RunnerResult> TaskSchedulerNode::JoinRunningTask(int task_id) {
   return results;
 }
 
+Optional<Array<MeasureCandidate>> TaskSchedulerNode::GenerateMeasureCandidates(int task_id) {
+  return this->tasks_[task_id]->ctx->search_strategy.value()->GenerateMeasureCandidates();
+}
+
 void TaskSchedulerNode::TouchTask(int task_id) {
   TaskRecordNode* task = this->tasks_[task_id].get();
   if (!task->is_terminated && task->runner_futures.defined()) {
@@ -0,0 +1,232 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+#include "../support/socket.h"
+#include "utils.h"
+
+namespace tvm {
+namespace meta_schedule {
+
+struct WorkerPool::Worker {
+  /*! \brief The address of the worker. */
+  std::string address;
+  /*! \brief The connection to the worker, closed if the worker is not connected. */
+  support::TCPSocket sock;
+};
+
+/*! \brief Send a frame, whose length is sent as 4 bytes in little-endian regardless of the host. */
+static void SendFrame(support::TCPSocket* sock, const std::string& data) {
+  uint32_t size = data.size();
+  unsigned char header[4];
+  for (int i = 0; i < 4; ++i) {
+    header[i] = static_cast<unsigned char>(size >> (8 * i));
+  }
+  ICHECK_EQ(sock->SendAll(header, sizeof(header)), sizeof(header));
+  ICHECK_EQ(sock->SendAll(data.data(), data.size()), data.size());
+}
+
+/*! \brief Receive a frame sent by the worker. */
+static std::string RecvFrame(support::TCPSocket* sock) {
+  unsigned char header[4];
+  ICHECK_EQ(sock->RecvAll(header, sizeof(header)), sizeof(header));
+  uint32_t size = 0;
+  for (int i = 0; i < 4; ++i) {
+    size |= static_cast<uint32_t>(header[i]) << (8 * i);
+  }
+  std::string data(size, '\0');
+  ICHECK_EQ(sock->RecvAll(&data[0], size), size);
+  return data;
+}
+
+WorkerPool::WorkerPool(const Array<String>& workers, double timeout_sec,
+                       double heartbeat_timeout_sec, int max_retries)
+    : timeout_sec_(timeout_sec),
+      heartbeat_timeout_sec_(heartbeat_timeout_sec),
+      max_retries_(max_retries) {
+  CHECK(!workers.empty()) << "ValueError: At least one worker is required";
+  CHECK_GT(timeout_sec, 0.0) << "ValueError: `timeout_sec` must be positive";
+  CHECK_GT(heartbeat_timeout_sec, 0.0) << "ValueError: `heartbeat_timeout_sec` must be positive";
+  CHECK_GE(max_retries, 0) << "ValueError: `max_retries` must be non-negative";
+  support::Socket::Startup();
+  for (const String& address : workers) {
+    CHECK(std::string(address).rfind(':') != std::string::npos)
+        << "ValueError: Expect worker address in the form of \"host:port\", but gets: " << address;
+    workers_.emplace_back(new Worker{address, support::TCPSocket()});
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  for (const std::unique_ptr<Worker>& worker : workers_) {
+    if (!worker->sock.IsClosed()) {
+      worker->sock.Close();
+    }
+  }
+}
+
+bool WorkerPool::Connect(Worker* worker) {
+  if (!worker->sock.IsClosed()) {
+    return true;
+  }
+  size_t sep = worker->address.rfind(':');
+  std::string host = worker->address.substr(0, sep);
+  try {
+    support::SockAddr addr(host.c_str(), std::stoi(worker->address.substr(sep + 1)));
+    worker->sock.Create(addr.ss_family());
+    if (worker->sock.Connect(addr)) {
+      return true;
+    }
+  } catch (const std::exception& e) {  // includes tvm::Error and std::invalid_argument
+  }
+  LOG(WARNING) << "Failed to connect to the meta schedule worker at " << worker->address;
+  if (!worker->sock.IsClosed()) {
+    worker->sock.Close();
+  }
+  return false;
+}
+
+bool WorkerPool::Call(Worker* worker, const std::string& kind, const std::string& payload,
+                      Result* result) {
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point deadline =
+      Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                         std::chrono::duration<double>(timeout_sec_));
+  try {
+    SendFrame(&worker->sock, kind);
+    SendFrame(&worker->sock, payload);
+    for (;;) {
+      double remaining_sec = std::chrono::duration<double>(deadline - Clock::now()).count();
+      if (remaining_sec <= 0.0) {
+        // The job is finished as a failure rather than retried, since it is likely to time out
+        // again. Dropping the connection makes the daemon kill the job.
+        result->ok = false;
+        result->payload = "Timeout, killed after " + std::to_string(timeout_sec_) + " seconds";
+        worker->sock.Close();
+        return true;
+      }
+      double wait_sec = std::min(remaining_sec, heartbeat_timeout_sec_);
+      support::PollHelper poll;
+      poll.WatchRead(worker->sock.sockfd);
+      poll.Poll(static_cast<int>(std::ceil(wait_sec * 1000)));
+      if (poll.CheckRead(worker->sock.sockfd)) {
+        std::string status = RecvFrame(&worker->sock);
+        if (status == "heartbeat") {
+          continue;
+        }
+        ICHECK(status == "ok" || status == "error") << "Unknown status: " << status;
+        result->ok = status == "ok";
+        result->payload = RecvFrame(&worker->sock);
+        return true;
+      }
+      if (wait_sec == heartbeat_timeout_sec_) {
+        LOG(WARNING) << "The meta schedule worker at " << worker->address << " has not sent a "
+                     << "heartbeat for " << heartbeat_timeout_sec_ << " second(s)";
+        break;
+      }
+    }
+  } catch (const std::runtime_error& e) {  // includes tvm::Error and dmlc::Error
+    LOG(WARNING) << "Lost the connection to the meta schedule worker at " << worker->address
+                 << ": " << e.what();
+  }
+  worker->sock.Close();
+  return false;
+}
+
+std::vector<WorkerPool::Result> WorkerPool::Run(const std::string& kind,
+                                                const std::vector<std::string>& payloads) {
+  std::lock_guard<std::mutex> batch_lock(mutex_);
+  int n = payloads.size();
+  std::vector<Result> results(n);
+  std::vector<bool> finished(n, false);
+  std::vector<int> failures(n, 0);
+  std::deque<int> queue;
+  for (int i = 0; i < n; ++i) {
+    queue.push_back(i);
+  }
+  int num_running = 0;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  auto f_serve = [&](Worker* worker) {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      // Wait for a job, or for all jobs to finish. A running job may be put back on failure.
+      cv.wait(lock, [&]() { return !queue.empty() || num_running == 0; });
+      if (queue.empty()) {
+        return;
+      }
+      // Reconnect if the last job dropped the connection. A worker that cannot be reached leaves
+      // the rest to the other workers.
+      lock.unlock();
+      bool connected = Connect(worker);
+      lock.lock();
+      if (!connected) {
+        return;
+      }
+      if (queue.empty()) {
+        continue;
+      }
+      int job_id = queue.front();
+      queue.pop_front();
+      ++num_running;
+      lock.unlock();
+      Result result;
+      bool responded = Call(worker, kind, payloads[job_id], &result);
+      lock.lock();
+      --num_running;
+      if (responded) {
+        results[job_id] = std::move(result);
+        finished[job_id] = true;
+      } else if (++failures[job_id] > max_retries_) {
+        results[job_id] = Result{false, "The meta schedule worker failed " +
+                                            std::to_string(failures[job_id]) + " time(s)"};
+        finished[job_id] = true;
+      } else {
+        queue.push_front(job_id);
+      }
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(workers_.size());
+  for (const std::unique_ptr<Worker>& worker : workers_) {
+    threads.emplace_back(f_serve, worker.get());
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (int i = 0; i < n; ++i) {
+    if (!finished[i]) {
+      results[i] = Result{false, "No meta schedule worker is available"};
+    }
+  }
+  return results;
+}
+
+}  // namespace meta_schedule
+}  // namespace tvm
@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+#ifndef TVM_META_SCHEDULE_WORKER_POOL_H_
+#define TVM_META_SCHEDULE_WORKER_POOL_H_
+
+#include <tvm/runtime/container/array.h>
+#include <tvm/runtime/container/string.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tvm {
+namespace meta_schedule {
+
+/*!
+ * \brief A pool of connections to worker daemons (`python -m tvm.exec.meta_schedule_worker`)
+ * that serve the build and run jobs of meta schedule.
+ *
+ * The protocol is a sequence of frames over TCP, each being a 4-byte little-endian length
+ * followed by the bytes. A request is two frames, the job kind and its payload. While working on
+ * a job the daemon sends a "heartbeat" frame periodically, and it finishes the job with an "ok"
+ * or an "error" frame followed by the result or the error message.
+ *
+ * Jobs are pulled from a shared queue by one thread per connection, so a fast worker takes more
+ * jobs than a slow one. A job whose worker dies or stays silent for longer than the heartbeat
+ * timeout is put back into the queue, up to `max_retries` times. The connection is dropped and
+ * re-established before the next job, and a worker that cannot be reached any more leaves the rest
+ * to the other workers. A job still running after `timeout_sec` fails without retry.
+ */
+class WorkerPool {
+ public:
+  /*! \brief The outcome of a job. */
+  struct Result {
+    /*! \brief Whether the job succeeded. */
+    bool ok;
+    /*! \brief The result of the job, or the error message. */
+    std::string payload;
+  };
+
+  /*!
+   * \brief Constructor.
+   * \param workers The addresses of the workers in the form of "host:port". The same address can
+   * appear multiple times to open multiple connections to the same daemon.
+   * \param timeout_sec The time after which a job is killed and reported as failed.
+   * \param heartbeat_timeout_sec The time without any frame from a busy worker after which it is
+   * considered dead.
+   * \param max_retries The maximal number of times a job is re-dispatched after worker failures.
+   */
+  explicit WorkerPool(const Array<String>& workers, double timeout_sec,
+                      double heartbeat_timeout_sec, int max_retries);
+  ~WorkerPool();
+  /*!
+   * \brief Run a batch of jobs of the same kind on the workers, blocking until all of them finish.
+   * \param kind The kind of the jobs, e.g. "build" or "run".
+   * \param payloads The payloads of the jobs.
+   * \return The outcomes of the jobs in the same order.
+   */
+  std::vector<Result> Run(const std::string& kind, const std::vector<std::string>& payloads);
+
+ private:
+  struct Worker;
+  /*! \brief (Re-)connect a worker if it is not connected. */
+  bool Connect(Worker* worker);
+  /*!
+   * \brief Run a job on a worker. Returns false if the worker fails to respond, in which case the
+   * job can be retried. A job timing out is finished as a failure.
+   */
+  bool Call(Worker* worker, const std::string& kind, const std::string& payload, Result* result);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  double timeout_sec_;
+  double heartbeat_timeout_sec_;
+  int max_retries_;
+  /*! \brief Serializes the batches, since each connection serves one job at a time. */
+  std::mutex mutex_;
+};
+
+}  // namespace meta_schedule
+}  // namespace tvm
+
+#endif  // TVM_META_SCHEDULE_WORKER_POOL_H_
@@ -19,11 +19,70 @@
 
 #include "./graph_partitioner.h"
 
+#include <limits>
 #include <vector>
 
 namespace tvm {
 namespace relay {
 
+namespace {
+
+/*! \brief Returns the number of elements of a statically shaped tensor type, or -1. */
+int64_t StaticNumElements(const TensorTypeNode* ttype) {
+  int64_t num_elements = 1;
+  for (const PrimExpr& dim : ttype->shape) {
+    const auto* int_dim = dim.as<IntImmNode>();
+    if (int_dim == nullptr) {
+      return -1;
+    }
+    num_elements *= int_dim->value;
+  }
+  return num_elements;
+}
+
+/*! \brief Returns the size in bytes of a statically shaped tensor or tuple type, or -1. */
+int64_t StaticBytes(const Type& type) {
+  if (const auto* ttype = type.as<TensorTypeNode>()) {
+    int64_t num_elements = StaticNumElements(ttype);
+    int64_t element_bytes = (ttype->dtype.bits() * ttype->dtype.lanes() + 7) / 8;
+    return num_elements < 0 ? -1 : num_elements * element_bytes;
+  } else if (const auto* tuple_type = type.as<TupleTypeNode>()) {
+    int64_t total = 0;
+    for (const Type& field : tuple_type->fields) {
+      int64_t bytes = StaticBytes(field);
+      if (bytes < 0) {
+        return -1;
+      }
+      total += bytes;
+    }
+    return total;
+  }
+  return -1;
+}
+
+/*! \brief Returns the checked type of the expression of a graph node, if any. */
+Optional<Type> NodeType(const IndexedForwardGraph::Node* node) {
+  const auto* expr = GetRef<ObjectRef>(node->ref).as<ExprNode>();
+  if (expr == nullptr || !expr->checked_type_.defined()) {
+    return NullOpt;
+  }
+  return expr->checked_type_;
+}
+
+/*! \brief Returns a short description of a graph node for logging. */
+std::string NodeName(const IndexedForwardGraph::Node* node) {
+  std::ostringstream os;
+  os << "node[" << node->index << "]";
+  if (const auto* call = GetRef<ObjectRef>(node->ref).as<CallNode>()) {
+    if (const auto* op = call->op.as<OpNode>()) {
+      os << " " << op->name;
+    }
+  }
+  return os.str();
+}
+
+}  // namespace
+
 DominatorTree DominatorTree::PostDom(support::Arena* arena, const IndexedForwardGraph& graph) {
   DominatorTree tree;
   tree.nodes.resize(graph.post_dfs_order.size(), nullptr);
@@ -301,6 +360,70 @@ size_t GraphPartitioner::CountFusedArgs(const IndexedForwardGraph& graph,
   return args_num;
 }
 
+void GraphPartitioner::CollectFusedOutputs_(IndexedForwardGraph::Node* src,
+                                            IndexedForwardGraph::Node* sink,
+                                            std::vector<IndexedForwardGraph::Node*>* outputs) {
+  if (src == sink || visited_.count(src)) return;
+  visited_.insert(src);
+  Group* root = groups_[src->index]->FindRoot();
+  if (root->root_ref == src->ref && root != groups_[sink->index]->FindRoot()) {
+    outputs->push_back(src);
+  }
+  for (auto link = src->outputs.head; link != nullptr; link = link->next) {
+    CollectFusedOutputs_(link->value.node, sink, outputs);
+  }
+}
+
+double GraphPartitioner::EstimateFusionBenefit(IndexedForwardGraph::Node* src,
+                                               IndexedForwardGraph::Node* sink) {
+  std::vector<IndexedForwardGraph::Node*> outputs;
+  visited_.clear();
+  CollectFusedOutputs_(src, sink, &outputs);
+  double benefit = 0;
+  for (IndexedForwardGraph::Node* node : outputs) {
+    Optional<Type> type = NodeType(node);
+    int64_t bytes = type.defined() ? StaticBytes(type.value()) : -1;
+    if (bytes < 0) {
+      // Nothing is known about dynamic shapes, keep the greedy decision.
+      return std::numeric_limits<double>::infinity();
+    }
+    // The output is no longer written to and read back from memory.
+    benefit += 2.0 * bytes;
+    // Estimate the cost of recomputing an element for every extra time that it is read.
+    const auto* ttype = type.value().as<TensorTypeNode>();
+    const auto* call = GetRef<ObjectRef>(node->ref).as<CallNode>();
+    if (ttype == nullptr || call == nullptr) continue;
+    int64_t num_elements = StaticNumElements(ttype);
+    int64_t input_bytes = 0;
+    for (const Expr& arg : call->args) {
+      if (arg->checked_type_.defined()) {
+        input_bytes += std::max<int64_t>(StaticBytes(arg->checked_type_), 0);
+      }
+    }
+    for (auto link = node->outputs.head; link != nullptr; link = link->next) {
+      if (link->value.pattern > kInjective) continue;
+      Optional<Type> consumer_type = NodeType(link->value.node);
+      const auto* consumer_ttype =
+          consumer_type.defined() ? consumer_type.value().as<TensorTypeNode>() : nullptr;
+      int64_t consumer_elements = consumer_ttype ? StaticNumElements(consumer_ttype) : -1;
+      if (num_elements > 0 && consumer_elements > num_elements) {
+        double reads_per_element = static_cast<double>(consumer_elements) / num_elements;
+        benefit -= (reads_per_element - 1) * input_bytes;
+      }
+    }
+  }
+  return benefit;
+}
+
+bool GraphPartitioner::AcceptFusion(IndexedForwardGraph::Node* src,
+                                    IndexedForwardGraph::Node* sink) {
+  if (!use_cost_model_) return true;
+  double benefit = EstimateFusionBenefit(src, sink);
+  VLOG(1) << (benefit > 0 ? "Fusing " : "Not fusing ") << NodeName(src) << " into "
+          << NodeName(sink) << ", estimated memory traffic saved: " << benefit << " bytes";
+  return benefit > 0;
+}
+
 void GraphPartitioner::InitGroups(const IndexedForwardGraph& graph) {
   auto args_counter = [this](const tvm::Object* obj) {
     size_t args_num = 0;
@@ -426,7 +549,8 @@ void GraphPartitioner::RunFuse(const IndexedForwardGraph& graph,    //
         ICHECK(dom_node->parent->gnode != nullptr);
         // The fuse can be executed if all the intermediate ops are still broadcast.
         auto fcond = [](OpPatternKind kind, bool is_sink) { return kind <= kBroadcast; };
-        if (CheckPath(graph_node, dom_node->parent->gnode, fcond)) {
+        if (CheckPath(graph_node, dom_node->parent->gnode, fcond) &&
+            AcceptFusion(graph_node, dom_node->parent->gnode)) {
           CommitFuse(graph_node, dom_node->parent->gnode);
         }
       }
@@ -446,7 +570,8 @@ void GraphPartitioner::RunFuse(const IndexedForwardGraph& graph,    //
                     kind == kOutEWiseFusable);
           }
         };
-        if (CheckPath(graph_node, dom_node->parent->gnode, fcond)) {
+        if (CheckPath(graph_node, dom_node->parent->gnode, fcond) &&
+            AcceptFusion(graph_node, dom_node->parent->gnode)) {
           CommitFuse(graph_node, dom_node->parent->gnode);
         }
       }
@@ -456,12 +581,25 @@ void GraphPartitioner::RunFuse(const IndexedForwardGraph& graph,    //
       if (phase != 1) continue;
       // Check if all path are injective.
       auto fcond = [](OpPatternKind kind, bool is_sink) { return kind <= kInjective; };
-      if (CheckPath(graph_node, dom_node->parent->gnode, fcond)) {
+      if (CheckPath(graph_node, dom_node->parent->gnode, fcond) &&
+          AcceptFusion(graph_node, dom_node->parent->gnode)) {
         CommitFuse(graph_node, dom_node->parent->gnode);
       }
     } else {
-      // do nothing.
       ICHECK(group_node->pattern == kCommReduce);
+      // The greedy algorithm never fuses a reduction. With the cost model, the elementwise
+      // epilogue of a reduction is fused when profitable, so the reduced tensor stays in registers.
+      if (!use_cost_model_ || phase != 0 || dom_node->pattern != kElemWise ||
+          postpone_node_ != nullptr) {
+        continue;
+      }
+      auto fcond = [](OpPatternKind kind, bool is_sink) { return kind <= kBroadcast; };
+      if (CheckPath(graph_node, dom_node->parent->gnode, fcond) &&
+          AcceptFusion(graph_node, dom_node->parent->gnode)) {
+        CommitFuse(graph_node, dom_node->parent->gnode);
+        // The fused group now contains a reduction, which must not be merged with another one.
+        groups_[dom_parent_gindex]->FindRoot()->pattern = kCommReduce;
+      }
     }
   }
 }
@@ -163,11 +163,12 @@ class DominatorTree {
 class GraphPartitioner {
  public:
   explicit GraphPartitioner(support::Arena* arena, int opt_level, size_t max_fuse_depth,
-                            size_t max_function_args)
+                            size_t max_function_args, bool use_cost_model = false)
       : arena_(arena),
         opt_level_(opt_level),
         max_fuse_depth_(max_fuse_depth),
-        max_function_args_(max_function_args) {}
+        max_function_args_(max_function_args),
+        use_cost_model_(use_cost_model) {}
   /*!
    * \brief Group as a union find data structure.
    */
@@ -215,6 +216,11 @@ class GraphPartitioner {
   size_t max_fuse_depth_;
   /*! \brief The maximum number of arguments in one fused function */
   size_t max_function_args_;
+  /*!
+   * \brief Whether each candidate fusion is checked against an analytical memory traffic model,
+   * which also enables fusing reductions into their elementwise consumers.
+   */
+  bool use_cost_model_;
   /*! \brief The internal groups. */
   std::vector<Group*> groups_;
   /*! \brief internal field used for deduplication */
@@ -297,6 +303,26 @@ class GraphPartitioner {
   // limit will be exceeded.
   size_t CountFusedArgs(const IndexedForwardGraph& graph, IndexedForwardGraph::Node* child);
 
+  // Internal implementation of EstimateFusionBenefit
+  void CollectFusedOutputs_(IndexedForwardGraph::Node* src, IndexedForwardGraph::Node* sink,
+                            std::vector<IndexedForwardGraph::Node*>* outputs);
+  /*!
+   * \brief Estimate the memory traffic saved by fusing the nodes from src up to sink.
+   * The outputs of the groups which become internal are no longer written and read back, while
+   * consumers that read an element of them several times, such as broadcasts, now recompute it
+   * from its inputs.
+   * \param src The source node.
+   * \param sink The termination node.
+   * \return The estimated number of bytes saved, negative if the fusion is harmful.
+   * \note sink must be a post-dominator of src.
+   */
+  double EstimateFusionBenefit(IndexedForwardGraph::Node* src, IndexedForwardGraph::Node* sink);
+  /*!
+   * \brief Check whether fusing the nodes from src up to sink is profitable, and log the decision.
+   * Always true without the cost model.
+   */
+  bool AcceptFusion(IndexedForwardGraph::Node* src, IndexedForwardGraph::Node* sink);
+
   // Initialize the groups.
   void InitGroups(const IndexedForwardGraph& graph);
 
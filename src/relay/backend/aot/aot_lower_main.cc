@@ -33,6 +33,7 @@
 #include "../../transforms/device_aware_visitors.h"
 #include "../name_transforms.h"
 #include "../utils.h"
+#include "./parallel_dispatch.h"
 
 namespace tvm {
 namespace relay {
@@ -219,6 +220,7 @@ class AOTMainLowerer : public MixedModeVisitor {
   IRModule Lower(IRModule mod, String mod_name) {
     VLOG_CONTEXT << "AOT";
     IRModule lowered_mod = GetRef<IRModule>(mod.CopyOnWrite());
+    parallel_dispatch_ = UseParallelDispatch(mod, config_);
 
     auto lowered_main = lowered_mod->Lookup("main");
     auto lowered_main_func = Downcast<Function>(lowered_main);
@@ -417,7 +419,8 @@ class AOTMainLowerer : public MixedModeVisitor {
    * runner function needs to be legalized by the LegalizePackedCalls pass.
    */
   tir::PrimFunc CreateMainFunc(String mod_name) {
-    tir::Stmt body = tir::SeqStmt::Flatten(stmts_);
+    tir::Stmt body = parallel_dispatch_ ? ScheduleParallelDispatch(stmts_, stmt_accesses_)
+                                        : tir::SeqStmt::Flatten(stmts_);
     // Allocate the sids
     std::unordered_map<int, bool> allocated;
     std::vector<std::pair<int64_t, int64_t>> sids_to_allocate;
@@ -612,16 +615,19 @@ class AOTMainLowerer : public MixedModeVisitor {
     std::string func_name = call_lowered_props.lowered_func->name_hint;
     tvm::Array<PrimExpr> args{tvm::tir::StringImm(func_name)};
     std::vector<tir::Stmt> create_func_call_stmts;
+    MainStmtAccess access;
 
     // Pack the inputs
     for (const Expr& arg : call_lowered_props.arguments) {
       auto sids = FindExpr(arg);
       PushArgs(arg, sids, &args);
+      access.reads.insert(access.reads.end(), sids.begin(), sids.end());
     }
 
     // Pack the return(s) value. A call node can produce multiple outputs
     auto result_expr_sid = PackSid(result_expr);
     PushArgs(result_expr, result_expr_sid, &args);
+    access.writes = result_expr_sid;
 
     GlobalVar global_var = call_lowered_props.lowered_func;
     bool has_c_device_api_context = device_contexts_.count(global_var) != 0;
@@ -672,10 +678,12 @@ class AOTMainLowerer : public MixedModeVisitor {
           func_call,
           GenerateDeviceHook(device_context, "Close"),
       }));
+      access.parallel_safe = false;
     }
 
     tir::Stmt body = tir::SeqStmt::Flatten(func_call);
     stmts_.push_back(body);
+    stmt_accesses_.push_back(access);
   }
 
   /*!
@@ -696,7 +704,11 @@ class AOTMainLowerer : public MixedModeVisitor {
     tir::Stmt copy = tir::For(
         loop_idx, 0, tir::make_const(DataType::Int(32, 1), size, Span()), tir::ForKind::kSerial,
         tir::BufferStore(tmp_write, tir::Let(tmp_read->data, in, retval_i), {loop_idx}));
+    MainStmtAccess access;
+    if (auto opt = in.as<tir::Var>()) access.reads.push_back(opt.value());
+    if (auto opt = out.as<tir::Var>()) access.writes.push_back(opt.value());
     stmts_.push_back(tir::LetStmt(tmp_write->data, out, copy));
+    stmt_accesses_.push_back(access);
   }
 
   /*!
@@ -837,6 +849,10 @@ class AOTMainLowerer : public MixedModeVisitor {
   std::unordered_map<int, tir::Var> sids_table_;
   /*! \brief the set of statements that make the program */
   std::vector<tir::Stmt> stmts_;
+  /*! \brief the buffers accessed by each of stmts_ */
+  std::vector<MainStmtAccess> stmt_accesses_;
+  /*! \brief whether independent operator calls are dispatched in parallel */
+  bool parallel_dispatch_{false};
   /*! \brief the list of return sids (note that the function might return more then one output */
   std::vector<int> return_sid_;
   /*! \brief This is per IO var name counter to aid the generating unique names */
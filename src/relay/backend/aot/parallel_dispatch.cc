@@ -0,0 +1,114 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file src/relay/backend/aot/parallel_dispatch.cc
+ * \brief Dependency aware parallel dispatch of operator calls in the AOT main function.
+ */
+#include "./parallel_dispatch.h"
+
+#include <tvm/relay/executor.h>
+#include <tvm/tir/expr.h>
+#include <tvm/tir/op.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace tvm {
+namespace relay {
+namespace backend {
+namespace aot {
+
+bool UseParallelDispatch(const IRModule& mod, const CompilationConfig& config) {
+  Optional<Executor> executor = mod->GetAttr<Executor>(tvm::attr::kExecutor);
+  if (!executor || !executor.value()->GetAttr<Bool>("parallel-dispatch").value_or(Bool(false))) {
+    return false;
+  }
+  // Only the LLVM codegen lowers parallel dispatch in host code.
+  if (config->host_target->kind->name != "llvm") {
+    LOG(WARNING) << "AOT parallel-dispatch requires an llvm host target, got "
+                 << config->host_target->kind->name << ". Operators are dispatched sequentially.";
+    return false;
+  }
+  return true;
+}
+
+tir::Stmt ScheduleParallelDispatch(const std::vector<tir::Stmt>& stmts,
+                                   const std::vector<MainStmtAccess>& accesses) {
+  ICHECK_EQ(stmts.size(), accesses.size());
+  using VarLevelMap = std::unordered_map<tir::Var, int, ObjectPtrHash, ObjectPtrEqual>;
+  // The highest wave writing and reading each buffer so far.
+  VarLevelMap write_level;
+  VarLevelMap read_level;
+  // Statements which are not parallel safe act as barriers.
+  int min_level = 0;
+  int max_level = -1;
+  std::vector<std::vector<tir::Stmt>> waves;
+
+  for (size_t i = 0; i < stmts.size(); ++i) {
+    const MainStmtAccess& access = accesses[i];
+    int level = min_level;
+    if (!access.parallel_safe) {
+      level = max_level + 1;
+    } else {
+      auto after = [&level](const VarLevelMap& levels, const tir::Var& var) {
+        auto it = levels.find(var);
+        if (it != levels.end()) level = std::max(level, it->second + 1);
+      };
+      for (const tir::Var& var : access.reads) after(write_level, var);
+      for (const tir::Var& var : access.writes) {
+        after(write_level, var);
+        after(read_level, var);
+      }
+    }
+    for (const tir::Var& var : access.reads) {
+      read_level[var] = std::max(read_level.count(var) ? read_level[var] : 0, level);
+    }
+    for (const tir::Var& var : access.writes) {
+      write_level[var] = std::max(write_level.count(var) ? write_level[var] : 0, level);
+    }
+    if (!access.parallel_safe) min_level = level + 1;
+    max_level = std::max(max_level, level);
+    if (static_cast<int>(waves.size()) <= level) waves.resize(level + 1);
+    waves[level].push_back(stmts[i]);
+  }
+
+  std::vector<tir::Stmt> body;
+  for (const auto& wave : waves) {
+    if (wave.empty()) continue;
+    if (wave.size() == 1) {
+      body.push_back(wave[0]);
+      continue;
+    }
+    // Dispatch the wave as tasks running a chain of branches, one per statement.
+    tir::Var task_id("task_id", DataType::Int(32));
+    tir::Stmt dispatch = wave.back();
+    for (int j = static_cast<int>(wave.size()) - 2; j >= 0; --j) {
+      dispatch = tir::IfThenElse(task_id == j, wave[j], dispatch);
+    }
+    body.push_back(tir::AttrStmt(task_id, tir::attr::parallel_dispatch,
+                                 static_cast<int>(wave.size()), dispatch));
+  }
+  return tir::SeqStmt::Flatten(body);
+}
+
+}  // namespace aot
+}  // namespace backend
+}  // namespace relay
+}  // namespace tvm
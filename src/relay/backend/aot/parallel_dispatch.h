@@ -0,0 +1,81 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef TVM_RELAY_BACKEND_AOT_PARALLEL_DISPATCH_H_
+#define TVM_RELAY_BACKEND_AOT_PARALLEL_DISPATCH_H_
+
+#include <tvm/ir/module.h>
+#include <tvm/target/compilation_config.h>
+#include <tvm/tir/stmt.h>
+#include <tvm/tir/var.h>
+
+#include <vector>
+
+namespace tvm {
+namespace relay {
+namespace backend {
+namespace aot {
+
+/*! \brief Buffers accessed by one statement of the AOT main function. */
+struct MainStmtAccess {
+  /*! \brief The buffer vars read by the statement. */
+  std::vector<tir::Var> reads;
+  /*! \brief The buffer vars written by the statement. */
+  std::vector<tir::Var> writes;
+  /*!
+   * \brief Whether the statement may run concurrently with others. Statements
+   * invoking device hooks are not, as hooks are not required to be thread safe.
+   */
+  bool parallel_safe{true};
+};
+
+/*!
+ * \brief Check whether the "parallel-dispatch" executor option is enabled and
+ * supported by the host target of the compilation.
+ * \param mod The module carrying the executor attribute.
+ * \param config The compilation config.
+ */
+bool UseParallelDispatch(const IRModule& mod, const CompilationConfig& config);
+
+/*!
+ * \brief Arrange the statements of the AOT main function into waves of
+ * mutually independent statements.
+ *
+ * A statement is placed into the first wave after all statements it has a
+ * read-after-write, write-after-read or write-after-write dependency on.
+ * Waves with more than one statement are wrapped in a tir::attr::parallel_dispatch
+ * scope, which LLVM codegen lowers to TVMBackendParallelDispatch. Every statement
+ * of the wave then runs as a single-threaded task, so operators with parallel
+ * loops of their own remain safe to call. The USMP treats all buffers accessed
+ * within the scope as live for the whole scope, so the memory plan stays
+ * conflict free.
+ *
+ * \param stmts The statements in their sequential execution order.
+ * \param accesses The buffer accesses of each statement.
+ * \return The body of the main function.
+ */
+tir::Stmt ScheduleParallelDispatch(const std::vector<tir::Stmt>& stmts,
+                                   const std::vector<MainStmtAccess>& accesses);
+
+}  // namespace aot
+}  // namespace backend
+}  // namespace relay
+}  // namespace tvm
+
+#endif  // TVM_RELAY_BACKEND_AOT_PARALLEL_DISPATCH_H_
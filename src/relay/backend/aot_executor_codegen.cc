@@ -50,6 +50,7 @@
 #include "../op/call/call.h"
 #include "../op/memory/device_copy.h"
 #include "../transforms/device_aware_visitors.h"
+#include "./aot/parallel_dispatch.h"
 #include "./name_transforms.h"
 #include "./te_compiler.h"
 #include "./utils.h"
@@ -422,6 +423,7 @@ class AOTExecutorCodegen : public MixedModeVisitor {
     std::string func_name = call_lowered_props.lowered_func->name_hint;
     tvm::Array<PrimExpr> args{tvm::tir::StringImm(func_name)};
     std::vector<tir::Stmt> create_func_call_stmts;
+    aot::MainStmtAccess access;
 
     // Pack the inputs
     for (const Expr& arg : call_lowered_props.arguments) {
@@ -437,12 +439,14 @@ class AOTExecutorCodegen : public MixedModeVisitor {
       } else {
         auto sids = FindExpr(arg);
         PushArgs(arg, sids, &args);
+        access.reads.insert(access.reads.end(), sids.begin(), sids.end());
       }
     }
 
     // Pack the return(s) value. A call node can produce multiple outputs
     auto result_expr_sid = PackSid(result_expr);
     PushArgs(result_expr, result_expr_sid, &args);
+    access.writes = result_expr_sid;
 
     GlobalVar global_var = call_lowered_props.lowered_func;
     bool has_c_device_api_context = device_contexts_.count(global_var) != 0;
@@ -518,10 +522,12 @@ class AOTExecutorCodegen : public MixedModeVisitor {
           func_call,
           GenerateDeviceHook(device_context, "Close"),
       }));
+      access.parallel_safe = false;
     }
 
     tir::Stmt body = tir::SeqStmt::Flatten(func_call);
     stmts_.push_back(body);
+    stmt_accesses_.push_back(access);
   }
 
   /*!
@@ -558,7 +564,11 @@ class AOTExecutorCodegen : public MixedModeVisitor {
                     tir::ForKind::kSerial, copy);
     copy = tir::MergeNest(let_nest, copy);
 
+    aot::MainStmtAccess access;
+    if (auto opt = in.as<tir::Var>()) access.reads.push_back(opt.value());
+    if (auto opt = out.as<tir::Var>()) access.writes.push_back(opt.value());
     stmts_.push_back(copy);
+    stmt_accesses_.push_back(access);
   }
 
   /*
@@ -778,7 +788,8 @@ class AOTExecutorCodegen : public MixedModeVisitor {
   // the packed function calls don't pack their arguments. The AOT
   // runner function needs to be legalized by the LegalizePackedCalls pass.
   tir::PrimFunc CreateMainFunc(String mod_name, unsigned int relay_params) {
-    tir::Stmt body = tir::SeqStmt::Flatten(stmts_);
+    tir::Stmt body = parallel_dispatch_ ? aot::ScheduleParallelDispatch(stmts_, stmt_accesses_)
+                                        : tir::SeqStmt::Flatten(stmts_);
     // Allocate the sids
     std::unordered_map<int, bool> allocated;
 
@@ -1070,6 +1081,10 @@ class AOTExecutorCodegen : public MixedModeVisitor {
   Map<String, FunctionInfo> function_metadata_;
   /*! \brief the set of statements that make the program */
   std::vector<tir::Stmt> stmts_;
+  /*! \brief the buffers accessed by each of stmts_ */
+  std::vector<aot::MainStmtAccess> stmt_accesses_;
+  /*! \brief whether independent operator calls are dispatched in parallel */
+  bool parallel_dispatch_{false};
   /*! \brief the list of return sids (note that the function might return more then one output */
   std::vector<int> return_sid_;
   /*! \brief This is per IO var name counter to aid the generating unique names */
@@ -1120,6 +1135,7 @@ class AOTExecutorCodegen : public MixedModeVisitor {
       ICHECK(false) << "runtime_config (" << runtime_config->name
                     << ") is not one of the expected values";
     }
+    parallel_dispatch_ = aot::UseParallelDispatch(mod, config_);
 
     mod = transform::ToANormalForm()(mod);
     mod = transform::InferType()(mod);
@@ -88,6 +88,12 @@ using namespace relay::transform;
 /*! \brief The host device is always stored at device index 0. */
 constexpr Index kHostDeviceIndex = 0;
 
+/*!
+ * \brief Static shapes "main" is specialized for, see transform::SpecializeShapeBuckets. Every
+ * bucket maps parameter names to static shapes.
+ */
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.vm.shape_buckets", Array<ObjectRef>);
+
 // (@jroesch): VM passes, eventually declare as passes.
 bool IsClosure(const Function& func);
 
@@ -1049,8 +1055,17 @@ transform::Sequential VMCompiler::FuseAndLowerOperators(const CompilationConfig&
 
 IRModule VMCompiler::OptimizeModuleImpl(IRModule mod) {
   backend::BindParamsInModule(mod, params_);
-  Array<Pass> pass_seqs = relay::backend::GetPassPrefix(
-      /*is_homogeneous=*/config_->optional_homogeneous_target.defined(), /*is_vm=*/true);
+  transform::PassContext pass_ctx = PassContext::Current();
+  Array<Pass> pass_seqs;
+  // Add the static-shape copies of "main" first, so they go through all the optimizations.
+  if (auto buckets =
+          pass_ctx->GetConfig<Array<Map<String, Array<Integer>>>>("relay.vm.shape_buckets")) {
+    pass_seqs.push_back(transform::SpecializeShapeBuckets(buckets.value()));
+  }
+  for (const Pass& pass : relay::backend::GetPassPrefix(
+           /*is_homogeneous=*/config_->optional_homogeneous_target.defined(), /*is_vm=*/true)) {
+    pass_seqs.push_back(pass);
+  }
 
   // Always plan devices so the remaining passes don't need to distinguish homogeneous vs
   // heterogeneous execution.
@@ -1067,7 +1082,6 @@ IRModule VMCompiler::OptimizeModuleImpl(IRModule mod) {
   pass_seqs.push_back(transform::AnnotateMemoryScope());
 
   // Do layout rewrite for auto-scheduler.
-  transform::PassContext pass_ctx = PassContext::Current();
   if (backend::IsAutoSchedulerEnabled() && config_->optional_homogeneous_target.defined()) {
     Pass major_pass = transform::AutoSchedulerLayoutRewrite();
     bool enable_layout_rewrite_targets =
@@ -39,6 +39,9 @@ namespace tvm {
 namespace relay {
 namespace transform {
 
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.FoldConstant.skip_layout_transform", Bool);
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.FoldConstant.batched", Bool);
+
 namespace {
 /*!
  * \brief Returns whether \p expr is a literal \p Constant, optionally wrapped by an "on_device"
@@ -63,18 +66,84 @@ bool IsComplexConstant(const Expr& expr) {
   }
 }
 
+using ExprSet = std::unordered_set<Expr, ObjectPtrHash, ObjectPtrEqual>;
+
+/*!
+ * \brief Collects the outermost deferred sub-expressions of an expression, ie those which are not
+ * themselves an argument of another deferred sub-expression.
+ */
+class DeferredRootCollector : public MixedModeVisitor {
+ public:
+  explicit DeferredRootCollector(const ExprSet& deferred) : deferred_(deferred) {}
+
+  Array<Expr> Collect(const Expr& expr) {
+    VisitExpr(expr);
+    return roots_;
+  }
+
+ private:
+  bool CheckVisited(const Expr& expr) final {
+    if (deferred_.count(expr)) {
+      // Do not descend into the arguments, they are evaluated along with the root.
+      if (visited_roots_.insert(expr).second) {
+        roots_.push_back(expr);
+      }
+      return true;
+    }
+    return MixedModeVisitor::CheckVisited(expr);
+  }
+
+  const ExprSet& deferred_;
+  ExprSet visited_roots_;
+  Array<Expr> roots_;
+};
+
 // TODO(tvm-team) consider combine dead-code with constant folder.
 // or make a more powerful partial evaluator.
 class ConstantFolder : public MixedModeMutator {
  public:
-  explicit ConstantFolder(IRModule module, bool fold_qnn)
+  explicit ConstantFolder(IRModule module, bool fold_qnn, bool skip_layout_transform = false,
+                          bool batched = false)
       : module_(std::move(module)),
         fold_qnn_(fold_qnn),
+        skip_layout_transform_(skip_layout_transform),
+        batched_(batched),
         device_copy_op_(Op::Get("device_copy")),
         shape_of_op_(Op::Get("shape_of")),
         vm_shape_of_op_(Op::Get("vm.shape_of")),
         cast_op_(Op::Get("cast")),
-        ndarray_size_op_(Op::Get("ndarray_size")) {}
+        ndarray_size_op_(Op::Get("ndarray_size")),
+        layout_transform_op_(Op::Get("layout_transform")),
+        auto_scheduler_layout_transform_op_(Op::Get("auto_scheduler_layout_transform")),
+        meta_schedule_layout_transform_op_(Op::Get("meta_schedule_layout_transform")) {}
+
+  /*!
+   * \brief Folds the constant sub-expressions of \p expr. In batched mode, all foldable
+   * sub-expressions are first collected, and then evaluated together by a single invocation of
+   * the interpreter, so that the module is compiled only once and identical primitives share their
+   * lowered kernels.
+   */
+  Expr Fold(const Expr& expr) {
+    Expr result = VisitExpr(expr);
+    if (deferred_.empty()) {
+      return result;
+    }
+    Array<Expr> roots = DeferredRootCollector(deferred_).Collect(result);
+    if (roots.empty()) {
+      return result;
+    }
+    VLOG(1) << "Evaluating " << roots.size() << " constant sub-expressions in one batch";
+    Expr values = ConstEvaluate(Tuple(roots));
+    const auto* tuple_node = values.as<TupleNode>();
+    ICHECK(tuple_node != nullptr && tuple_node->fields.size() == roots.size());
+    // Substitute the evaluated values, and fold what they enable (let-bound constants, projections
+    // from constant tuples and conditionals on constants) in a final eager pass.
+    ConstantFolder folder(module_, fold_qnn_, skip_layout_transform_);
+    for (size_t i = 0; i < roots.size(); ++i) {
+      folder.memo_[roots[i]] = tuple_node->fields[i];
+    }
+    return folder.VisitExpr(result);
+  }
 
  private:
   using ExprMutator::VisitExpr_;
@@ -83,7 +152,7 @@ class ConstantFolder : public MixedModeMutator {
     auto pre_visit = [this](const LetNode* op) {
       // Rely on the Memoizer to cache pre-visit values
       Expr new_value = Mutate(op->value);
-      if (IsSimpleConstant(new_value)) {
+      if (IsSimpleConstant(new_value) || deferred_.count(new_value)) {
         // Inline new value (along with any on_device annotation wrapping it) at all occurrences of
         // the variable.
         //
@@ -114,7 +183,7 @@ class ConstantFolder : public MixedModeMutator {
       Expr expr = GetRef<Expr>(op);
       // Rely on the Memoizer to cache pre-visit values
       Expr new_value = this->Mutate(op->value);
-      if (IsSimpleConstant(new_value)) {
+      if (IsSimpleConstant(new_value) || deferred_.count(new_value)) {
         // The let-bound value has been inlined, drop the let-binding itself.
         this->memo_[expr] = Mutate(op->body);
       } else {
@@ -193,10 +262,22 @@ class ConstantFolder : public MixedModeMutator {
       // We should think about potentially constant evaluation over these ops too.
       return std::move(post_call);
     }
-    if (!std::all_of(post_call->args.begin(), post_call->args.end(), IsComplexConstant)) {
+    if (skip_layout_transform_ &&
+        (op == layout_transform_op_ || op == auto_scheduler_layout_transform_op_ ||
+         op == meta_schedule_layout_transform_op_)) {
+      // Keep the canonical weights in the artifact, and let the executor pack them at load time.
+      return std::move(post_call);
+    }
+    if (!std::all_of(post_call->args.begin(), post_call->args.end(),
+                     [this](const Expr& arg) { return IsFoldable(arg); })) {
       // At least one non-constant argument.
       return std::move(post_call);
     }
+    if (batched_) {
+      // Evaluated along with all other foldable calls once the whole expression is visited.
+      deferred_.insert(post_call);
+      return std::move(post_call);
+    }
     // During evaluation we have obviously lost all on_device annotations. However any
     // on_device wrapping this call will be left in place.
     return ConstEvaluate(post_call);
@@ -204,7 +285,12 @@ class ConstantFolder : public MixedModeMutator {
 
   Expr VisitExpr_(const IfNode* if_node) final {
     If new_if = Downcast<If>(ExprMutator::VisitExpr_(if_node));
-    if (const auto* const_node = AsIgnoringOnDevice<ConstantNode>(new_if->cond)) {
+    Expr cond = new_if->cond;
+    if (deferred_.count(cond)) {
+      // The branch taken must be known now, so the condition cannot wait for the batch.
+      cond = ConstEvaluate(cond);
+    }
+    if (const auto* const_node = AsIgnoringOnDevice<ConstantNode>(cond)) {
       if (reinterpret_cast<uint8_t*>(const_node->data->data)[0]) {
         return new_if->true_branch;
       } else {
@@ -227,9 +313,32 @@ class ConstantFolder : public MixedModeMutator {
         return result;
       }
     }
+    if (deferred_.count(post_tuple_get_item_node->tuple)) {
+      deferred_.insert(post_tuple_get_item);
+    }
     return post_tuple_get_item;
   }
 
+  /*!
+   * \brief Returns whether \p expr \p IsComplexConstant, or will be a constant once the deferred
+   * sub-expressions are evaluated.
+   */
+  bool IsFoldable(const Expr& expr) const {
+    if (IsSimpleConstant(expr)) {
+      return true;
+    }
+    OnDeviceProps props = GetOnDeviceProps(expr);
+    const Expr& body = props.body.defined() ? props.body : expr;
+    if (deferred_.count(body)) {
+      return true;
+    } else if (const auto* tuple_node = body.as<TupleNode>()) {
+      return std::all_of(tuple_node->fields.begin(), tuple_node->fields.end(),
+                         [this](const Expr& field) { return IsFoldable(field); });
+    } else {
+      return false;
+    }
+  }
+
   // Convert value to expression.
   Expr ObjectToExpr(const ObjectRef& value) {
     if (value->IsInstance<runtime::NDArray::ContainerType>()) {
@@ -395,6 +504,15 @@ class ConstantFolder : public MixedModeMutator {
   // Whether to fold constants for QNN operations.
   bool fold_qnn_;
 
+  // Whether to leave layout transforms of constants to be computed at load time.
+  bool skip_layout_transform_;
+
+  // Whether to evaluate all foldable sub-expressions in one batch.
+  bool batched_;
+
+  // The foldable sub-expressions whose evaluation is deferred to the batch.
+  ExprSet deferred_;
+
   // The kDLCPU device assumed to be available to the compiler. Used only when evaluating
   // sub-expressions.
   Device eval_cpu_dev_{kDLCPU, /*device_id=*/0};
@@ -408,6 +526,9 @@ class ConstantFolder : public MixedModeMutator {
   const Op& vm_shape_of_op_;
   const Op& cast_op_;
   const Op& ndarray_size_op_;
+  const Op& layout_transform_op_;
+  const Op& auto_scheduler_layout_transform_op_;
+  const Op& meta_schedule_layout_transform_op_;
 
   // True if currently within a "primitive" Relay Function.
   bool inside_primitive_ = false;
@@ -437,8 +558,15 @@ TVM_REGISTER_GLOBAL("relay._transform.FoldConstantExpr")
 
 Pass FoldConstant(bool fold_qnn) {
   runtime::TypedPackedFunc<Function(Function, IRModule, PassContext)> pass_func =
-      [=](Function f, IRModule m, PassContext /* pc */) {
-        return Downcast<Function>(FoldConstantExpr(f, m, fold_qnn));
+      [=](Function f, IRModule m, PassContext pc) {
+        bool skip_layout_transform =
+            pc->GetConfig<Bool>("relay.FoldConstant.skip_layout_transform", Bool(false)).value();
+        bool batched = pc->GetConfig<Bool>("relay.FoldConstant.batched", Bool(false)).value();
+        if (!skip_layout_transform && !batched) {
+          return Downcast<Function>(FoldConstantExpr(f, m, fold_qnn));
+        }
+        return Downcast<Function>(
+            ConstantFolder(m, fold_qnn, skip_layout_transform, batched).Fold(f));
       };
   return CreateFunctionPass(pass_func, 2, "FoldConstant", {});
 }
@@ -88,6 +88,7 @@ static const Op& stop_fusion_op = Op::Get("annotation.stop_fusion");
 
 TVM_REGISTER_PASS_CONFIG_OPTION("relay.FuseOps.max_depth", Integer);
 TVM_REGISTER_PASS_CONFIG_OPTION("relay.FuseOps.link_params", Bool);
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.FuseOps.cost_model", String);
 
 // Creator of post dominator tree of the dataflow
 class IndexedForwardGraphCreator : private ExprVisitor {
@@ -319,11 +320,13 @@ class IndexedForwardGraphCreator : private ExprVisitor {
 
 class FuseMutator : private MixedModeMutator {
  public:
-  FuseMutator(int fuse_opt_level, size_t max_fuse_depth, size_t max_function_args, bool link_params)
+  FuseMutator(int fuse_opt_level, size_t max_fuse_depth, size_t max_function_args, bool link_params,
+              bool use_cost_model = false)
       : fuse_opt_level_(fuse_opt_level),
         max_fuse_depth_(max_fuse_depth),
         max_function_args_(max_function_args),
-        link_params_(link_params) {}
+        link_params_(link_params),
+        use_cost_model_(use_cost_model) {}
 
   // Run the transform
   Expr Transform(const Expr& body) {
@@ -335,7 +338,8 @@ class FuseMutator : private MixedModeMutator {
   Expr Transform(const Expr& body, int fuse_opt_level, size_t max_fuse_depth, bool link_params) {
     // setup the group map.
     auto graph = IndexedForwardGraphCreator::Create(&arena_, body);
-    auto groups = GraphPartitioner(&arena_, fuse_opt_level, max_fuse_depth, max_function_args_)
+    auto groups = GraphPartitioner(&arena_, fuse_opt_level, max_fuse_depth, max_function_args_,
+                                   use_cost_model_)
                       .Partition(graph);
     for (size_t nid = 0; nid < graph.post_dfs_order.size(); ++nid) {
       ICHECK(graph.post_dfs_order[nid]->ref != nullptr);
@@ -351,6 +355,7 @@ class FuseMutator : private MixedModeMutator {
   size_t max_fuse_depth_;
   size_t max_function_args_;
   bool link_params_;
+  bool use_cost_model_;
 
   using MixedModeMutator::VisitExpr_;
 
@@ -552,8 +557,9 @@ class FuseMutator : private MixedModeMutator {
 };
 
 Expr FuseOps(const Expr& expr, int fuse_opt_level, size_t max_fuse_depth, size_t max_function_args,
-             bool link_params, const IRModule& module) {
-  return FuseMutator(fuse_opt_level, max_fuse_depth, max_function_args, link_params)
+             bool link_params, const IRModule& module, bool use_cost_model = false) {
+  return FuseMutator(fuse_opt_level, max_fuse_depth, max_function_args, link_params,
+                     use_cost_model)
       .Transform(expr);
 }
 
@@ -576,8 +582,13 @@ Pass FuseOps(int fuse_opt_level) {
             (target.defined())
                 ? target->GetAttr<Integer>("max_function_args", Integer(0)).value().IntValue()
                 : 0;
+        String cost_model = pc->GetConfig("relay.FuseOps.cost_model", String("greedy")).value();
+        CHECK(cost_model == "greedy" || cost_model == "analytical")
+            << "ValueError: relay.FuseOps.cost_model must be \"greedy\" or \"analytical\", but got "
+            << cost_model;
         return Downcast<Function>(FuseOps(f, opt_level, max_fuse_depth.value().IntValue(),
-                                          max_function_args, link_params, m));
+                                          max_function_args, link_params, m,
+                                          cost_model == "analytical"));
       };
   return CreateFunctionPass(pass_func, 0, "FuseOps", {"InferType"});
 }
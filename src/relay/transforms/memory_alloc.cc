@@ -34,6 +34,7 @@
 #include <tvm/relay/op.h>
 #include <tvm/relay/transform.h>
 #include <tvm/runtime/logging.h>
+#include <tvm/runtime/vm/vm.h>
 #include <tvm/target/target.h>
 
 #include <cstdint>
@@ -288,6 +289,7 @@ class DialectRewriter : public transform::DeviceAwareExprMutator {
     // Establish the arguments to the shape function.
     Array<Expr> shape_func_ins;
     int input_pos = 0;
+    bool shape_only = true;
     ICHECK_EQ(ins->fields.size(), input_states.size());
     for (size_t i = 0; i < ins->fields.size(); ++i) {
       const Expr& arg = ins->fields[i];
@@ -309,6 +311,7 @@ class DialectRewriter : public transform::DeviceAwareExprMutator {
           input_pos++;
         }
       } else if (state == tec::kNeedInputData) {
+        shape_only = false;
         auto new_arg = Mutate(arg);  // already accounts for device
         VirtualDevice arg_virtual_device = GetVirtualDevice(arg);
         ICHECK(!arg_virtual_device->IsFullyUnconstrained());
@@ -343,9 +346,21 @@ class DialectRewriter : public transform::DeviceAwareExprMutator {
       out_shapes.push_back(alloc);
     }
 
+    // Shape functions which only depend on the input shapes are pure in their (host) inputs,
+    // so let the VM memoize their results across invocations.
+    DictAttrs shape_func_attrs = Downcast<DictAttrs>(attrs.metadata.at("relay_attrs"));
+    if (shape_only) {
+      Map<String, ObjectRef> dict;
+      if (shape_func_attrs.defined() && shape_func_attrs->dict.defined()) {
+        dict = shape_func_attrs->dict;
+      }
+      dict.Set(runtime::vm::kMemoizeAttr, String("1"));
+      shape_func_attrs = DictAttrs(dict);
+    }
+
     // Represent the call in DPS form.
     auto shape_call = InvokeTVMOp(prim_fn_var, Tuple(shape_func_ins), Tuple(out_shapes),
-                                  Downcast<DictAttrs>(attrs.metadata.at("relay_attrs")));
+                                  shape_func_attrs);
     Var shape_func_var("shape_func", Type(nullptr));
     scope->Push(shape_func_var, MaybeOnDeviceFixed(shape_call, host_virtual_device_));
     return out_shapes;
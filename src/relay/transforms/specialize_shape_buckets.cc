@@ -0,0 +1,153 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file specialize_shape_buckets.cc
+ * \brief Add static-shape specializations of a dynamically shaped function, and dispatch to
+ * them on the runtime shapes of the arguments.
+ */
+#include <tvm/ir/global_var_supply.h>
+#include <tvm/relay/expr.h>
+#include <tvm/relay/transform.h>
+
+#include "../op/make_op.h"
+#include "./pattern_utils.h"
+
+namespace tvm {
+namespace relay {
+namespace {
+
+TensorType ParamTensorType(const Var& param) {
+  Type type = param->checked_type_.defined() ? param->checked_type_ : param->type_annotation;
+  const auto* tensor_type = type.as<TensorTypeNode>();
+  CHECK(tensor_type) << "ValueError: shape bucket given for parameter " << param->name_hint()
+                     << " that is not a tensor, its type is " << type;
+  return GetRef<TensorType>(tensor_type);
+}
+
+/*!
+ * \brief Make the runtime check that the arguments match a bucket, or an undefined Expr if
+ * the bucket fixes no dynamic dimension.
+ */
+Expr MakeBucketCondition(const Function& func, const Map<String, Array<Integer>>& bucket) {
+  static const Op& logical_and = Op::Get("logical_and");
+  Expr cond;
+  for (const Var& param : func->params) {
+    auto it = bucket.find(param->name_hint());
+    if (it == bucket.end()) {
+      continue;
+    }
+    TensorType type = ParamTensorType(param);
+    const Array<Integer>& shape = (*it).second;
+    CHECK_EQ(type->shape.size(), shape.size())
+        << "ValueError: shape bucket " << shape << " does not match the rank of parameter "
+        << param->name_hint() << " of type " << type;
+    for (size_t i = 0; i < shape.size(); ++i) {
+      if (const auto* dim = type->shape[i].as<IntImmNode>()) {
+        CHECK_EQ(dim->value, shape[i]->value)
+            << "ValueError: shape bucket " << shape << " does not match the static shape of "
+            << "parameter " << param->name_hint() << " of type " << type;
+        continue;
+      }
+      Expr dim = MakeTake(MakeShapeOf(param, DataType::Int(64)),
+                          MakeConstantScalar(DataType::Int(32), static_cast<int>(i)),
+                          /*batch_dims=*/0, /*axis=*/0, /*mode=*/"clip");
+      Expr dim_cond = Equal(dim, MakeConstantScalar(DataType::Int(64), shape[i]->value));
+      cond = cond.defined() ? Call(logical_and, {cond, dim_cond}) : dim_cond;
+    }
+  }
+  return cond;
+}
+
+/*! \brief Copy the function with the parameters in the bucket given static shapes. */
+Function MakeSpecialization(const Function& func, const Map<String, Array<Integer>>& bucket) {
+  Function copy = Downcast<Function>(DeDup(func));
+  Array<Var> params;
+  Map<Var, Expr> binds;
+  for (const Var& param : copy->params) {
+    auto it = bucket.find(param->name_hint());
+    if (it == bucket.end()) {
+      params.push_back(param);
+      continue;
+    }
+    TensorType type = ParamTensorType(param);
+    Array<PrimExpr> shape;
+    for (const Integer& dim : (*it).second) {
+      shape.push_back(IntImm(type->shape[shape.size()].dtype(), dim->value));
+    }
+    Var static_param(param->name_hint(), TensorType(shape, type->dtype), param->span);
+    params.push_back(static_param);
+    binds.Set(param, static_param);
+  }
+  return WithoutAttr(Function(params, Bind(copy->body, binds), Type(), copy->type_params,
+                              copy->attrs, copy->span),
+                     tvm::attr::kGlobalSymbol);
+}
+
+IRModule SpecializeShapeBuckets(IRModule mod, const Array<Map<String, Array<Integer>>>& buckets,
+                                const String& func_name) {
+  if (buckets.empty() || !mod->ContainGlobalVar(func_name)) {
+    return mod;
+  }
+  GlobalVar gvar = mod->GetGlobalVar(func_name);
+  Optional<Function> opt_func = mod->Lookup(gvar).as<Function>();
+  if (!opt_func || opt_func.value()->HasNonzeroAttr(attr::kPrimitive)) {
+    return mod;
+  }
+  Function func = opt_func.value();
+  GlobalVarSupply global_var_supply(mod);
+  Array<Expr> args(func->params.begin(), func->params.end());
+  // Build the dispatch from the last bucket to the first, so buckets are checked in order.
+  Expr body = func->body;
+  for (size_t i = buckets.size(); i-- > 0;) {
+    Expr cond = MakeBucketCondition(func, buckets[i]);
+    if (!cond.defined()) {
+      LOG(WARNING) << "Shape bucket " << buckets[i] << " fixes no dynamic dimension of "
+                   << func_name << ", skipping it.";
+      continue;
+    }
+    GlobalVar bucket_gvar = global_var_supply->FreshGlobal(
+        func_name + "_shape_bucket_" + std::to_string(i), /*add_prefix=*/false);
+    mod.CopyOnWrite()->Add(bucket_gvar, MakeSpecialization(func, buckets[i]));
+    body = If(cond, Call(bucket_gvar, args), body);
+  }
+  if (!body.same_as(func->body)) {
+    mod.CopyOnWrite()->Update(gvar, WithFields(func, func->params, body));
+  }
+  return mod;
+}
+
+}  // namespace
+
+namespace transform {
+
+Pass SpecializeShapeBuckets(Array<Map<String, Array<Integer>>> buckets, String func_name) {
+  runtime::TypedPackedFunc<IRModule(IRModule, PassContext)> pass_func =
+      [=](IRModule mod, PassContext pc) {
+        return relay::SpecializeShapeBuckets(std::move(mod), buckets, func_name);
+      };
+  return tvm::transform::CreateModulePass(pass_func, 0, "SpecializeShapeBuckets", {});
+}
+
+TVM_REGISTER_GLOBAL("relay._transform.SpecializeShapeBuckets")
+    .set_body_typed(SpecializeShapeBuckets);
+
+}  // namespace transform
+}  // namespace relay
+}  // namespace tvm
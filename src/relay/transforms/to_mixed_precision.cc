@@ -25,10 +25,13 @@
  */
 
 #include <tvm/ir/attrs.h>
+#include <tvm/node/structural_hash.h>
 #include <tvm/relay/expr_functor.h>
 #include <tvm/relay/transform.h>
 #include <tvm/runtime/object.h>
 
+#include <sstream>
+#include <unordered_set>
 #include <utility>
 
 #include "../../support/scalars.h"
@@ -38,6 +41,30 @@ namespace tvm {
 namespace relay {
 
 TVM_REGISTER_PASS_CONFIG_OPTION("relay.ToMixedPrecision.keep_orig_output_dtype", Bool);
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.ToMixedPrecision.keep_fp32_calls", Array<String>);
+
+/*!
+ * \brief Returns a key identifying calls to the same operator with the same attributes and
+ * argument types, used to keep the calls found to be slower in mixed precision in float32.
+ */
+std::string MixedPrecisionCallKey(const Call& call) {
+  std::ostringstream os;
+  const auto* op = call->op.as<OpNode>();
+  ICHECK(op != nullptr) << "Expected a call to an operator, but got " << call->op;
+  os << op->name << "(";
+  for (size_t i = 0; i < call->args.size(); ++i) {
+    const Expr& arg = call->args[i];
+    Type type = arg->checked_type_.defined() ? arg->checked_type_ : transform::InferTypeLocal(arg);
+    os << (i > 0 ? ", " : "") << PrettyPrint(type);
+  }
+  os << ")";
+  if (call->attrs.defined()) {
+    os << "#" << StructuralHash()(call->attrs);
+  }
+  return os.str();
+}
+
+TVM_REGISTER_GLOBAL("relay._transform.MixedPrecisionCallKey").set_body_typed(MixedPrecisionCallKey);
 // A callable which hashes std::pair
 struct pair_hash {
   template <class T1, class T2>
@@ -110,6 +137,8 @@ class MixedPrecisionPass : public MixedModeMutator {
   const RelayExprNode* root_;
   std::vector<DataType> original_dtype_;
   bool keep_orig_output_dtype_;
+  /*! \brief The keys of the calls which must stay in float32, see MixedPrecisionCallKey. */
+  std::unordered_set<std::string> keep_fp32_calls_;
 
   /*! \brief If some of the constant attributes are out of mixed_precision_type_ bounds, then
    * computation cannot be performed in mixed precision. */
@@ -320,11 +349,13 @@ class MixedPrecisionPass : public MixedModeMutator {
   using MixedModeMutator::VisitExpr_;
 
   explicit MixedPrecisionPass(Expr base, bool keep_orig_output_dtype,
-                              DataType mixed_precision_type = DataType::Float(16))
+                              DataType mixed_precision_type = DataType::Float(16),
+                              const Array<String>& keep_fp32_calls = {})
       : MixedModeMutator(),
         mixed_precision_type_(mixed_precision_type),
         root_(Downcast<Function>(base)->body.get()),
-        keep_orig_output_dtype_(keep_orig_output_dtype) {
+        keep_orig_output_dtype_(keep_orig_output_dtype),
+        keep_fp32_calls_(keep_fp32_calls.begin(), keep_fp32_calls.end()) {
     if (keep_orig_output_dtype_) {
       if (root_->IsInstance<tvm::relay::TupleNode>()) {
         const TupleTypeNode* tuple_type = (root_->checked_type_).as<TupleTypeNode>();
@@ -390,6 +421,11 @@ class MixedPrecisionPass : public MixedModeMutator {
         accumulation_dtype = mixed_precision_type_;
         output_dtype = mixed_precision_type_;
       }
+      if (!keep_fp32_calls_.empty() &&
+          keep_fp32_calls_.count(MixedPrecisionCallKey(GetRef<Call>(pre_call_node)))) {
+        // Measured to be slower, or not accurate enough, in mixed precision.
+        initial_category = MIXED_PRECISION_NEVER;
+      }
     } else {
       LOG(FATAL) << "Unsupported op type in CallNode: " << pre_call_node->op;
     }
@@ -502,11 +538,13 @@ class MixedPrecisionPass : public MixedModeMutator {
 
   // To access map of ops not registered for error reporting
   friend Expr ToMixedPrecision(const Expr& expr, bool keep_orig_output_dtype,
-                               const DataType& mixed_precision_type, int missing_op_mode);
+                               const DataType& mixed_precision_type, int missing_op_mode,
+                               const Array<String>& keep_fp32_calls);
 };
 
 Expr ToMixedPrecision(const Expr& expr, bool keep_orig_output_dtype,
-                      const DataType& mixed_precision_type, int missing_op_mode) {
+                      const DataType& mixed_precision_type, int missing_op_mode,
+                      const Array<String>& keep_fp32_calls) {
   /*
   missing_op_mode:
 
@@ -518,7 +556,7 @@ Expr ToMixedPrecision(const Expr& expr, bool keep_orig_output_dtype,
       << " missing_op_mode must be either 0, 1, or 2 got " << missing_op_mode;
 
   MixedPrecisionPass converter =
-      MixedPrecisionPass(expr, keep_orig_output_dtype, mixed_precision_type);
+      MixedPrecisionPass(expr, keep_orig_output_dtype, mixed_precision_type, keep_fp32_calls);
   auto result = converter.Mutate(expr);
 
   for (auto it = converter.missing_ops_.begin();
@@ -546,8 +584,10 @@ Pass ToMixedPrecision(DataType mixed_precision_type, int missing_op_mode) {
         keep_orig_output_dtype = pc->GetConfig("relay.ToMixedPrecision.keep_orig_output_dtype",
                                                Bool(keep_orig_output_dtype))
                                      .value();
-        return Downcast<Function>(
-            ToMixedPrecision(f, keep_orig_output_dtype, mixed_precision_type, missing_op_mode));
+        Array<String> keep_fp32_calls =
+            pc->GetConfig("relay.ToMixedPrecision.keep_fp32_calls", Array<String>()).value();
+        return Downcast<Function>(ToMixedPrecision(f, keep_orig_output_dtype, mixed_precision_type,
+                                                   missing_op_mode, keep_fp32_calls));
       };
   return CreateFunctionPass(pass_func, 0, "ToMixedPrecision", {});
 }
@@ -40,12 +40,16 @@
 
 #include <tvm/ir/transform.h>
 #include <tvm/ir/type_functor.h>
+#include <tvm/node/structural_equal.h>
+#include <tvm/node/structural_hash.h>
 #include <tvm/relay/analysis.h>
 #include <tvm/relay/dataflow_matcher.h>
 #include <tvm/relay/expr_functor.h>
 #include <tvm/relay/pattern_functor.h>
 #include <tvm/relay/transform.h>
 
+#include <mutex>
+
 #include "../analysis/type_solver.h"
 #include "pass_utils.h"
 
@@ -921,8 +925,122 @@ class SameTypedSubgraphExtractor : public ExprMutator {
   }
 };
 
+/*!
+ * \brief Remembers the functions produced by InferType, so that the incremental mode can reuse
+ * them as long as they and the types of the globals they refer to have not changed.
+ * \note The cache lives in the PassContext it was created for, so the recorded functions are
+ * released along with the context.
+ */
+class IncrementalTypeCacheNode : public Object {
+ public:
+  /*!
+   * \brief Records \p func as the result of type inference within \p mod, along with the types
+   * the inference gave to the globals it refers to.
+   */
+  void Record(const Function& func, const IRModule& mod) {
+    Entry entry;
+    entry.func = func;
+    entry.structural_hash = StructuralHash()(func);
+    entry.type_definitions = mod->type_definitions;
+    PostOrderVisit(func, [&](const Expr& expr) {
+      if (const auto* global_var = expr.as<GlobalVarNode>()) {
+        GlobalVar var = GetRef<GlobalVar>(global_var);
+        if (!entry.global_types.count(var)) {
+          entry.global_types.Set(var, GlobalType(var, mod));
+        }
+      }
+    });
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.size() >= kMaxEntries) {
+      entries_.clear();
+    }
+    entries_[func.get()] = std::move(entry);
+  }
+
+  /*! \brief Returns whether \p func is a recorded result that was not modified since. */
+  bool IsRecorded(const Function& func, const IRModule& mod) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(func.get());
+    if (it == entries_.end()) {
+      return false;
+    }
+    // Guard against in-place mutation of the recorded function.
+    return it->second.type_definitions.same_as(mod->type_definitions) &&
+           StructuralHash()(func) == it->second.structural_hash;
+  }
+
+  /*!
+   * \brief Returns whether the globals referred to by the recorded \p func still have the types
+   * they were inferred to when it was recorded.
+   */
+  bool GlobalTypesMatch(const Function& func, const IRModule& mod) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(func.get());
+    ICHECK(it != entries_.end());
+    for (const auto& kv : it->second.global_types) {
+      if (!StructuralEqual()(GlobalType(kv.first, mod), kv.second)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static constexpr const char* _type_key = "relay.IncrementalTypeCache";
+  TVM_DECLARE_FINAL_OBJECT_INFO(IncrementalTypeCacheNode, Object);
+
+ private:
+  struct Entry {
+    /*! \brief The recorded function, which also keeps the key alive. */
+    Function func;
+    size_t structural_hash;
+    Map<GlobalTypeVar, TypeData> type_definitions;
+    /*! \brief The inferred types of the referenced globals. */
+    Map<GlobalVar, Type> global_types;
+  };
+
+  /*! \brief Returns the type inferred for \p var within \p mod. */
+  static Type GlobalType(const GlobalVar& var, const IRModule& mod) {
+    if (mod->ContainGlobalVar(var->name_hint)) {
+      return mod->GetGlobalVar(var->name_hint)->checked_type_;
+    }
+    return var->checked_type_;
+  }
+
+  static constexpr size_t kMaxEntries = 1 << 10;
+  std::mutex mutex_;
+  std::unordered_map<const FunctionNode*, Entry> entries_;
+};
+
+TVM_REGISTER_OBJECT_TYPE(IncrementalTypeCacheNode);
+
+class IncrementalTypeCache : public ObjectRef {
+ public:
+  /*! \brief Returns the cache of \p pass_ctx, creating it on first use. */
+  static IncrementalTypeCache Get(tvm::transform::PassContext pass_ctx) {
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto cache = pass_ctx->GetConfig<IncrementalTypeCache>(kConfigKey)) {
+      return cache.value();
+    }
+    IncrementalTypeCache cache(make_object<IncrementalTypeCacheNode>());
+    pass_ctx->config.Set(kConfigKey, cache);
+    return cache;
+  }
+
+  TVM_DEFINE_MUTABLE_NOTNULLABLE_OBJECT_REF_METHODS(IncrementalTypeCache, ObjectRef,
+                                                    IncrementalTypeCacheNode);
+
+ private:
+  static constexpr const char* kConfigKey = "relay.InferType.incremental_cache";
+};
+
 namespace transform {
 
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.InferType.incremental", Bool);
+// Internal, holds the IncrementalTypeCache of the context. Registered so that configs copied
+// into a new PassContext still pass validation.
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.InferType.incremental_cache", IncrementalTypeCache);
+
 Type InferTypeLocal(const Expr& expr) {
   /*
   This type inference differs from InferType in that it uses existing type information
@@ -957,11 +1075,39 @@ Pass InferType() {
         IRModule updated_mod = mod->ShallowCopy();
 
         pass_ctx->diag_ctx = DiagnosticContext::Default(updated_mod);
+        Optional<IncrementalTypeCache> cache;
+        if (pass_ctx->GetConfig<Bool>("relay.InferType.incremental", Bool(false)).value()) {
+          cache = IncrementalTypeCache::Get(pass_ctx);
+        }
 
         // Add all the type annotations to the functions in the model.
         AddGlobalTypes(mod);
 
+        auto infer = [&](const GlobalVar& var, const Function& func) {
+          // TODO(@jroesch): we should be able to move the type inferencer outside
+          // of this function but it seems to be more stateful then I expect.
+          auto inferencer = TypeInferencer(mod, pass_ctx->diag_ctx.value());
+          auto updated_func = inferencer.Infer(var, func);
+
+          pass_ctx->diag_ctx.value().Render();
+
+          // After we are done checking write the global type back
+          // into the global var.
+          var->checked_type_ = updated_func->checked_type();
+
+          if (!WellFormed(updated_func, pass_ctx->diag_ctx)) {
+            LOG(FATAL) << "The type checked intermediate representation is malformed";
+          }
+
+          auto free_tvars = FreeTypeVars(updated_func, mod);
+          ICHECK(free_tvars.size() == 0)
+              << "Found unbound type variables in " << updated_func << ": " << free_tvars;
+          EnsureCheckedType(updated_func);
+          return Downcast<Function>(updated_func);
+        };
+
         std::vector<std::pair<GlobalVar, Function>> updates;
+        std::vector<std::pair<GlobalVar, Function>> reused;
         for (const auto& it : updated_mod->functions) {
           // Currently we don't type check TIR.
           //
@@ -970,35 +1116,37 @@ Pass InferType() {
           // In the future we plan a unified type checker
           // that works on TIR and Relay at the same time.
           if (auto func = it.second.as<Function>()) {
-            // // If a function already has type information we can skip checking it.
-            // if (func->checked_type_.defined()) {
-            //   continue;
-            // }
-
-            // TODO(@jroesch): we should be able to move the type inferencer outside
-            // of this function but it seems to be more stateful then I expect.
-            auto inferencer = TypeInferencer(mod, pass_ctx->diag_ctx.value());
-            auto updated_func = inferencer.Infer(it.first, func.value());
-
-            pass_ctx->diag_ctx.value().Render();
-
-            // After we are done checking write the global type back
-            // into the global var.
-            it.first->checked_type_ = updated_func->checked_type();
-
-            if (!WellFormed(updated_func, pass_ctx->diag_ctx)) {
-              LOG(FATAL) << "The type checked intermediate representation is malformed";
+            // In incremental mode, a function produced by a previous run is reused as long as
+            // it has not changed since.
+            if (cache.defined() && cache.value()->IsRecorded(func.value(), mod)) {
+              it.first->checked_type_ = func.value()->checked_type();
+              reused.push_back({it.first, func.value()});
+              continue;
             }
+            updates.push_back({it.first, infer(it.first, func.value())});
+          }
+        }
 
-            auto free_tvars = FreeTypeVars(updated_func, mod);
-            ICHECK(free_tvars.size() == 0)
-                << "Found unbound type variables in " << updated_func << ": " << free_tvars;
-            EnsureCheckedType(updated_func);
-            updates.push_back({it.first, Downcast<Function>(updated_func)});
+        // A reused function must also refer to globals whose inferred types did not change.
+        // Inferring it again may change its own global type in turn, so repeat until stable.
+        for (bool changed = true; changed;) {
+          changed = false;
+          for (auto it = reused.begin(); it != reused.end();) {
+            if (cache.value()->GlobalTypesMatch(it->second, mod)) {
+              ++it;
+              continue;
+            }
+            updates.push_back({it->first, infer(it->first, it->second)});
+            it = reused.erase(it);
+            changed = true;
           }
         }
 
+        // Record the results once all the global types are final.
         for (const auto& pair : updates) {
+          if (cache.defined()) {
+            cache.value()->Record(pair.second, mod);
+          }
           updated_mod->Add(pair.first, pair.second, true);
         }
 
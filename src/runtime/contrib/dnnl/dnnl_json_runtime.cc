@@ -22,12 +22,17 @@
  * \brief A simple JSON runtime for DNNL.
  */
 
+#include <dmlc/parameter.h>
 #include <tvm/runtime/ndarray.h>
 #include <tvm/runtime/registry.h>
 
 #include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "../json/json_node.h"
@@ -55,6 +60,8 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
         next_unique_eid_offset_(data_entry_.size()),
         run_arg_eid_(input_var_eid_) {
     for (const auto e : outputs_) run_arg_eid_.push_back(EntryID(e));
+    graph_cache_size_ = dmlc::GetEnv("TVM_DNNL_GRAPH_CACHE_SIZE", size_t(8));
+    ICHECK_GT(graph_cache_size_, 0) << "TVM_DNNL_GRAPH_CACHE_SIZE must be positive";
   }
 
   const char* type_key() const override { return "dnnl_json"; }
@@ -65,18 +72,30 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
 
     // Setup constants entries for weights.
     SetupConstants(consts);
-    BuildEngine();
+
+    engine_ = dnnl::engine(dnnl::engine::kind::cpu, 0);
+    stream_ = dnnl::stream(engine_);
+
+    // Build primitive graph for the batch size the graph was compiled with.
+    compiled_batch_size_ = GetCompiledBatchSize();
+    batched_entries_ = GetBatchedEntries();
+    std::lock_guard<std::mutex> lock(graph_cache_mutex_);
+    graph_cache_.emplace_front(compiled_batch_size_, BuildEngine(compiled_batch_size_));
   }
 
   /* Unused stub implementation */
   void Run() override { LOG(FATAL) << "Unreachable code"; }
 
-  /* Thread safe implementation of Run. Keep runtime instance immutable */
-  void Run(const TVMArgs& args) const {
+  /*
+   * Thread safe implementation of Run. Primitive graphs are immutable once built, only the
+   * batch size keyed cache of them is guarded by a lock.
+   */
+  void Run(const TVMArgs& args) {
+    auto graph = GetPrimitiveGraph(GetBatchSize(args));
     auto arg_data_provider = makeIODataProvider(args);
-    auto mem_solver = tensor_registry_.MakeSolver(arg_data_provider);
+    auto mem_solver = graph->tensor_registry.MakeSolver(arg_data_provider);
     // Execute primitives one by one
-    for (const auto& act : net_) {
+    for (const auto& act : graph->net) {
       auto prim = std::get<0>(act);
       auto arg_reqs = std::get<1>(act);
 
@@ -109,6 +128,11 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
 
         Run(args);
       });
+    } else if (name == "get_num_graph_builds") {
+      return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+        std::lock_guard<std::mutex> lock(graph_cache_mutex_);
+        *rv = num_graph_builds_;
+      });
     } else {
       return JSONRuntimeBase::GetFunction(name, sptr_to_self);
     }
@@ -133,6 +157,98 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
   }
 
  private:
+  /*! \brief Primitives and memory descriptors built for one particular batch size. */
+  struct PrimitiveGraph {
+    /* The network layers that are represented in dnnl primitives. */
+    TensorRegistry::ActionQue net;
+    /* Storage for all memory objects */
+    TensorRegistry tensor_registry;
+  };
+
+  /*! \brief Get batch size the JSON graph was compiled with, as leading dim of the first input. */
+  int64_t GetCompiledBatchSize() const {
+    for (const auto nid : input_nodes_) {
+      if (nodes_[nid].GetOpType() != "input") continue;
+      auto shape = nodes_[nid].GetOpShape()[0];
+      return shape.empty() ? 1 : shape[0];
+    }
+    return 1;
+  }
+
+  /*!
+   * \brief Mark the data entries carrying the batch dimension.
+   *
+   * Seeds are the graph inputs whose leading dim matches the compiled batch size. Outputs of a
+   * node consuming a batched entry are batched too if their leading dim matches, other entries
+   * (e.g. weights or shape-like tensors) keep their shapes when rebuilding for a new batch size.
+   */
+  std::vector<bool> GetBatchedEntries() const {
+    std::vector<bool> batched(data_entry_.size(), false);
+    auto mark = [&](uint32_t nid, uint32_t idx) {
+      auto shape = nodes_[nid].GetOpShape()[idx];
+      if (!shape.empty() && shape[0] == compiled_batch_size_) batched[EntryID(nid, idx)] = true;
+    };
+    for (const auto nid : input_nodes_) {
+      if (nodes_[nid].GetOpType() != "input") continue;
+      for (uint32_t idx = 0; idx < nodes_[nid].GetNumOutput(); ++idx) mark(nid, idx);
+    }
+    // JSON graph nodes are stored in topological order.
+    for (size_t nid = 0; nid < nodes_.size(); ++nid) {
+      const auto& node = nodes_[nid];
+      if (node.GetOpType() != "kernel") continue;
+      bool has_batched_input = false;
+      for (const auto& e : node.GetInputs()) has_batched_input |= batched[EntryID(e)];
+      if (!has_batched_input) continue;
+      for (uint32_t idx = 0; idx < node.GetNumOutput(); ++idx) mark(nid, idx);
+    }
+    return batched;
+  }
+
+  /*! \brief Get batch size from the runtime input shapes. */
+  int64_t GetBatchSize(const TVMArgs& args) const {
+    if (input_var_eid_.empty()) return compiled_batch_size_;
+    const DLTensor* tensor = args[0].IsObjectRef<NDArray>()
+                                 ? args[0].operator NDArray().operator->()
+                                 : args[0].operator DLTensor*();
+    return tensor->ndim == 0 ? 1 : tensor->shape[0];
+  }
+
+  /*!
+   * \brief Find primitive graph for the batch size in the LRU cache, build a new one on miss.
+   *
+   * Serving workloads with alternating batch sizes would otherwise rebuild all primitives on
+   * every change of the input shape. Least recently used graphs are evicted once the cache
+   * size set by TVM_DNNL_GRAPH_CACHE_SIZE is exceeded.
+   */
+  std::shared_ptr<const PrimitiveGraph> GetPrimitiveGraph(int64_t batch_size) {
+    std::lock_guard<std::mutex> lock(graph_cache_mutex_);
+    for (auto it = graph_cache_.begin(); it != graph_cache_.end(); ++it) {
+      if (it->first == batch_size) {
+        graph_cache_.splice(graph_cache_.begin(), graph_cache_, it);
+        return graph_cache_.front().second;
+      }
+    }
+    VLOG(1) << "Building DNNL primitives for function '" << symbol_name_ << "' with batch size "
+            << batch_size;
+    graph_cache_.emplace_front(batch_size, BuildEngine(batch_size));
+    if (graph_cache_.size() > graph_cache_size_) graph_cache_.pop_back();
+    return graph_cache_.front().second;
+  }
+
+  /*!
+   * \brief Get shape of the data entry for the batch size currently being built.
+   *
+   * Leading dimension of the entries derived from the batched inputs is treated as the batch
+   * dimension and replaced, see GetBatchedEntries. Other entries keep their shapes.
+   */
+  std::vector<int64_t> GetEntryShape(uint32_t nid, uint32_t idx) const {
+    auto shape = nodes_[nid].GetOpShape()[idx];
+    if (build_batch_size_ != compiled_batch_size_ && batched_entries_[EntryID(nid, idx)]) {
+      shape[0] = build_batch_size_;
+    }
+    return shape;
+  }
+
   const std::map<std::string, dnnl::algorithm> elt_name2algo{
       {"abs", dnnl::algorithm::eltwise_abs},
       {"exp", dnnl::algorithm::eltwise_exp},
@@ -245,10 +361,12 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
     return attr;
   }
 
-  // Build up the engine based on the input graph.
-  void BuildEngine() {
-    engine_ = dnnl::engine(dnnl::engine::kind::cpu, 0);
-    stream_ = dnnl::stream(engine_);
+  // Build up the engine based on the input graph. Must be called with graph_cache_mutex_ held.
+  std::shared_ptr<const PrimitiveGraph> BuildEngine(int64_t batch_size) {
+    build_batch_size_ = batch_size;
+    ++num_graph_builds_;
+    next_unique_eid_offset_ = data_entry_.size();
+    net_.clear();
 
     std::set<uint32_t> io_eid_set(run_arg_eid_.begin(), run_arg_eid_.end());
     tensor_registry_ = TensorRegistry(engine_, io_eid_set);
@@ -296,6 +414,12 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
         }
       }
     }
+
+    auto graph = std::make_shared<PrimitiveGraph>();
+    graph->net = std::move(net_);
+    graph->tensor_registry = std::move(tensor_registry_);
+    net_.clear();
+    return graph;
   }
 
   void Convolution(const size_t& nid) {
@@ -815,7 +939,7 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
     ICHECK_LT(idx, node.GetInputs().size());
     auto data_entry = node.GetInputs()[idx];
 
-    auto shape = nodes_[data_entry.id_].GetOpShape()[data_entry.index_];
+    auto shape = GetEntryShape(data_entry.id_, data_entry.index_);
     auto dtype = nodes_[data_entry.id_].GetOpDataType()[data_entry.index_];
     auto eid = node_row_ptr_[data_entry.id_] + data_entry.index_;
     auto const_dl_tensor = data_entry_[eid];
@@ -844,7 +968,7 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
     const JSONGraphNode& node = nodes_[nid];
 
     ICHECK_LT(idx, node.GetNumOutput());
-    auto shape = node.GetOpShape()[idx];
+    auto shape = GetEntryShape(nid, idx);
     auto dtype = node.GetOpDataType()[idx];
     auto eid = node_row_ptr_[nid] + static_cast<uint32_t>(idx);
 
@@ -917,14 +1041,28 @@ class DNNLJSONRuntime : public JSONRuntimeBase {
   dnnl::engine engine_;
   /* The dnnl stream. */
   dnnl::stream stream_;
-  /* The network layers that are represented in dnnl primitives. */
+  /* The network layers of the primitive graph being built. */
   TensorRegistry::ActionQue net_;
-  /* Storage for all memory objects */
+  /* Storage for all memory objects of the primitive graph being built. */
   TensorRegistry tensor_registry_;
   /* Generator of new unique eid which doesn't match with existing data entry */
   uint32_t next_unique_eid_offset_;
   /* Map of Run arg idx to corresponding eid */
   std::vector<uint32_t> run_arg_eid_;
+  /* Batch size the JSON graph was compiled with. */
+  int64_t compiled_batch_size_ = 1;
+  /* Whether the data entry with the given eid carries the batch dimension. */
+  std::vector<bool> batched_entries_;
+  /* Batch size of the primitive graph being built. */
+  int64_t build_batch_size_ = 1;
+  /* Max number of primitive graphs kept alive. */
+  size_t graph_cache_size_;
+  /* Primitive graphs keyed by batch size, most recently used first. */
+  std::list<std::pair<int64_t, std::shared_ptr<const PrimitiveGraph>>> graph_cache_;
+  /* Number of primitive graphs built so far, including evicted ones. */
+  int64_t num_graph_builds_ = 0;
+  /* Guards graph_cache_ and the build state above. */
+  std::mutex graph_cache_mutex_;
 };
 
 runtime::Module DNNLJSONRuntimeCreate(String symbol_name, String graph_json,
@@ -33,10 +33,12 @@
 #include <tvm/runtime/serializer.h>
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -59,9 +61,13 @@ constexpr auto Is2DStorage = IsTextureStorage;
  * \brief Run all the operations one by one.
  */
 void GraphExecutor::Run() {
+  if (weight_packing_) {
+    if (weight_pack_stale_) SetupWeightPacking();
+    RunWeightPacking();
+  }
   // setup the array and requirements.
   for (size_t i = 0; i < op_execs_.size(); ++i) {
-    if (op_execs_[i]) op_execs_[i]();
+    if (op_execs_[i] && !weight_pack_node_[i]) op_execs_[i]();
   }
 }
 
@@ -77,12 +83,22 @@ void GraphExecutor::Run() {
 void GraphExecutor::Init(const std::string& graph_json, tvm::runtime::Module module,
                          const std::vector<Device>& devs,
                          const PackedFunc lookup_linked_param_func) {
-  std::istringstream is(graph_json);
-  dmlc::JSONReader reader(&is);
-  this->Load(&reader);
+  uint64_t magic = 0;
+  if (graph_json.size() >= sizeof(magic)) {
+    std::memcpy(&magic, graph_json.data(), sizeof(magic));
+  }
+  if (magic == kTVMGraphBinaryMagic) {
+    dmlc::MemoryFixedSizeStream strm(const_cast<char*>(graph_json.data()), graph_json.size());
+    this->LoadBinary(&strm);
+  } else {
+    std::istringstream is(graph_json);
+    dmlc::JSONReader reader(&is);
+    this->Load(&reader);
+  }
   module_ = module;
   devices_ = devs;
   lookup_linked_param_ = lookup_linked_param_func;
+  custom_lookup_linked_param_ = lookup_linked_param_ != nullptr;
   if (lookup_linked_param_ == nullptr) {
     lookup_linked_param_ = PackedFunc(
         [this](TVMArgs args, TVMRetValue* rv) { this->DefaultLookupLinkedParam(args, rv); });
@@ -181,6 +197,15 @@ void GraphExecutor::SetInput(int index, DLTensor* data_in) {
   ICHECK_LT(static_cast<size_t>(index), input_nodes_.size());
   uint32_t eid = this->entry_id(input_nodes_[index], 0);
   data_entry_[eid].CopyFrom(data_in);
+  // The parameters are shared with the clones, which need to pack them again as well.
+  if (param_names_.count(nodes_[input_nodes_[index]].name)) ++*weight_version_;
+}
+void GraphExecutor::SetParam(const std::string& name, DLTensor* data_in) {
+  int in_idx = GetInputIndex(name);
+  ICHECK_GE(in_idx, 0) << "Cannot find parameter " << name << " in the graph inputs";
+  param_names_.insert(name);
+  this->SetInput(in_idx, data_in);
+  weight_pack_stale_ = true;
 }
 /*!
  * \brief Check the legality of external DLTensor*.
@@ -215,6 +240,9 @@ void GraphExecutor::SetInputZeroCopy(int index, DLTensor* data_ref) {
   for (DLTensor* t : input_dltensors_[eid]) {
     t->data = static_cast<char*>(data_ref->data) + data_ref->byte_offset;
   }
+  zero_copy_inputs_[eid] = static_cast<char*>(data_ref->data) + data_ref->byte_offset;
+  // Only this executor reads the new data, so the clones keep their packed weights.
+  if (weight_eids_.count(eid)) weight_pack_dirty_ = true;
 }
 /*!
  * \brief set index-th output to the graph without copying the data.
@@ -239,6 +267,7 @@ void GraphExecutor::SetOutputZeroCopy(int index, DLTensor* data_ref) {
   for (DLTensor* t : both_output_opinput_dltensors_[output_node_eid]) {
     t->data = static_cast<char*>(data_ref->data) + data_ref->byte_offset;
   }
+  zero_copy_outputs_[output_node_eid] = static_cast<char*>(data_ref->data) + data_ref->byte_offset;
 }
 /*!
  * \brief Get the number of outputs
@@ -311,6 +340,8 @@ void GraphExecutor::LoadParams(dmlc::Stream* strm) {
     uint32_t eid = this->entry_id(input_nodes_[in_idx], 0);
     data_entry_[eid].CopyFrom(p.second);
   }
+  weight_pack_stale_ = true;
+  ++*weight_version_;
 }
 
 void GraphExecutor::ShareParams(const GraphExecutor& other, dmlc::Stream* strm) {
@@ -334,8 +365,50 @@ void GraphExecutor::ShareParams(const GraphExecutor& other, dmlc::Stream* strm)
     ICHECK_GT(data_entry_[eid].use_count(), 1);
     const DLTensor* tmp = data_entry_[eid].operator->();
     data_alignment_[eid] = details::GetDataAlignment(*tmp);
+    param_names_.insert(names[i]);
   }
   this->SetupOpExecs();
+  weight_pack_stale_ = true;
+}
+
+Module GraphExecutor::Clone() const {
+  auto exec = make_object<GraphExecutor>();
+  exec->nodes_ = nodes_;
+  exec->input_nodes_ = input_nodes_;
+  exec->param_names_ = param_names_;
+  exec->input_map_ = input_map_;
+  exec->output_map_ = output_map_;
+  exec->node_row_ptr_ = node_row_ptr_;
+  exec->outputs_ = outputs_;
+  exec->attrs_ = attrs_;
+  exec->module_ = module_;
+  exec->devices_ = devices_;
+  exec->module_funcs_ = module_funcs_;
+  exec->custom_lookup_linked_param_ = custom_lookup_linked_param_;
+  exec->weight_packing_ = weight_packing_;
+  if (custom_lookup_linked_param_) {
+    exec->lookup_linked_param_ = lookup_linked_param_;
+  } else {
+    GraphExecutor* ptr = exec.get();
+    exec->lookup_linked_param_ = PackedFunc(
+        [ptr](TVMArgs args, TVMRetValue* rv) { ptr->DefaultLookupLinkedParam(args, rv); });
+  }
+  exec->SetupStorage();
+  auto share_entry = [this, &exec](uint32_t eid) {
+    exec->data_entry_[eid] = data_entry_[eid];
+    exec->data_alignment_[eid] = data_alignment_[eid];
+  };
+  for (const std::string& name : param_names_) {
+    auto it = input_map_.find(name);
+    if (it != input_map_.end()) share_entry(this->entry_id(input_nodes_[it->second], 0));
+  }
+  exec->SetupOpExecs();
+  // The packed weights are private to each executor, so that a clone packing them does not race
+  // with another one running. A change to the shared parameters is seen by all of them through
+  // the shared version.
+  exec->weight_version_ = weight_version_;
+  exec->weight_pack_stale_ = true;
+  return Module(exec);
 }
 
 void GraphExecutor::LinkedNDArrayDeleter(Object* container) {
@@ -492,9 +565,12 @@ void GraphExecutor::SetupStorage() {
 
 void GraphExecutor::SetupOpExecs() {
   op_execs_.resize(this->GetNumOfNodes());
-  input_dltensors_.resize(num_node_entries());
-  output_dltensors_.resize(num_node_entries());
-  both_output_opinput_dltensors_.resize(num_node_entries());
+  weight_pack_node_.resize(this->GetNumOfNodes(), false);
+  // The executors may be set up again, e.g. after sharing parameters, which invalidates the
+  // previously recorded DLTensor handles.
+  input_dltensors_.assign(num_node_entries(), {});
+  output_dltensors_.assign(num_node_entries(), {});
+  both_output_opinput_dltensors_.assign(num_node_entries(), {});
   std::unordered_set<uint32_t> input_node_eids;
   for (size_t i = 0; i < input_nodes_.size(); i++) {
     uint32_t nid = input_nodes_[i];
@@ -556,6 +632,93 @@ void GraphExecutor::SetupOpExecs() {
       }
     }
   }
+  // The handles recorded above point to the data entries again, so restore the zero copy bindings.
+  for (const auto& kv : zero_copy_inputs_) {
+    for (DLTensor* t : input_dltensors_[kv.first]) t->data = kv.second;
+  }
+  for (const auto& kv : zero_copy_outputs_) {
+    for (DLTensor* t : output_dltensors_[kv.first]) t->data = kv.second;
+    for (DLTensor* t : both_output_opinput_dltensors_[kv.first]) t->data = kv.second;
+  }
+}
+
+void GraphExecutor::SetupWeightPacking() {
+  weight_pack_stale_ = false;
+  // Start over, as more inputs may be parameters now. Nodes packed before keep their storage.
+  std::vector<bool> packed_before = weight_pack_node_;
+  std::fill(weight_pack_node_.begin(), weight_pack_node_.end(), false);
+  weight_eids_.clear();
+  for (const std::string& name : param_names_) {
+    int in_idx = GetInputIndex(name);
+    if (in_idx >= 0) weight_eids_.insert(this->entry_id(input_nodes_[in_idx], 0));
+  }
+  std::unordered_set<uint32_t> output_node_eids;
+  for (const NodeEntry& e : outputs_) {
+    output_node_eids.insert(this->entry_id(e));
+  }
+  std::vector<DLDataType> vtype;
+  for (const std::string& s_type : attrs_.dltype) {
+    vtype.push_back(tvm::runtime::String2DLDataType(s_type));
+  }
+  // Nodes are stored in topological order, so a single pass finds the whole packing subgraph.
+  for (uint32_t nid = 0; nid < this->GetNumOfNodes(); ++nid) {
+    const auto& inode = nodes_[nid];
+    if (inode.op_type == "null" || inode.inputs.empty()) continue;
+    bool from_weights = std::all_of(inode.inputs.begin(), inode.inputs.end(),
+                                    [this](const NodeEntry& e) {
+                                      return weight_eids_.count(this->entry_id(e)) != 0;
+                                    });
+    for (uint32_t index = 0; index < inode.param.num_outputs; ++index) {
+      from_weights = from_weights && !output_node_eids.count(this->entry_id(nid, index));
+    }
+    if (!from_weights) continue;
+    weight_pack_node_[nid] = true;
+    for (uint32_t index = 0; index < inode.param.num_outputs; ++index) {
+      uint32_t eid = this->entry_id(nid, index);
+      weight_eids_.insert(eid);
+      // A "__nop" output aliases the storage of its input, which may have been moved above.
+      if (inode.param.func_name == "__nop") {
+        data_entry_[eid] =
+            data_entry_[this->entry_id(inode.inputs[0])].CreateView(attrs_.shape[eid], vtype[eid]);
+        continue;
+      }
+      if (packed_before[nid]) continue;
+      // The planned storage is shared with the activations, so the packed weights need storage
+      // of their own to survive across inferences.
+      Optional<String> mem_scope;
+      if (!attrs_.storage_scope.empty() && !attrs_.storage_scope[eid].empty()) {
+        mem_scope = String(attrs_.storage_scope[eid]);
+      }
+      data_entry_[eid] =
+          NDArray::Empty(attrs_.shape[eid], vtype[eid], data_entry_[eid]->device, mem_scope);
+      data_alignment_[eid] = details::GetDataAlignment(*data_entry_[eid].operator->());
+    }
+  }
+  // The data entries of the packing nodes may have been replaced above.
+  bool any_packed = std::any_of(weight_pack_node_.begin(), weight_pack_node_.end(),
+                                [](bool packed) { return packed; });
+  if (any_packed || weight_pack_node_ != packed_before) {
+    this->SetupOpExecs();
+  }
+  weight_pack_dirty_ = true;
+}
+
+void GraphExecutor::EnableWeightPacking() {
+  if (weight_packing_) return;
+  weight_packing_ = true;
+  weight_pack_stale_ = true;
+}
+
+void GraphExecutor::RepackWeights() { ++*weight_version_; }
+
+void GraphExecutor::RunWeightPacking() {
+  uint64_t version = weight_version_->load();
+  if (!weight_pack_dirty_ && packed_weight_version_ == version) return;
+  for (size_t i = 0; i < op_execs_.size(); ++i) {
+    if (op_execs_[i] && weight_pack_node_[i]) op_execs_[i]();
+  }
+  weight_pack_dirty_ = false;
+  packed_weight_version_ = version;
 }
 
 std::pair<std::function<void()>, std::shared_ptr<GraphExecutor::OpArgs>> GraphExecutor::CreateTVMOp(
@@ -596,7 +759,11 @@ std::pair<std::function<void()>, std::shared_ptr<GraphExecutor::OpArgs>> GraphEx
 
   // Get compiled function from the module that contains both host and device
   // code.
-  tvm::runtime::PackedFunc pf = module_.GetFunction(param.func_name, true);
+  auto it = module_funcs_.find(param.func_name);
+  if (it == module_funcs_.end()) {
+    it = module_funcs_.emplace(param.func_name, module_.GetFunction(param.func_name, true)).first;
+  }
+  tvm::runtime::PackedFunc pf = it->second;
   ICHECK(pf != nullptr) << "no such function in module: " << param.func_name;
 
   auto fexec = [arg_ptr, pf]() {
@@ -608,6 +775,232 @@ std::pair<std::function<void()>, std::shared_ptr<GraphExecutor::OpArgs>> GraphEx
   return {fexec, arg_ptr};
 }
 
+namespace {
+/*! \brief Table of unique strings, used to intern the strings of a binary graph. */
+class StringTable {
+ public:
+  uint32_t Intern(const std::string& str) {
+    auto it = index_.emplace(str, static_cast<uint32_t>(strings_.size()));
+    if (it.second) {
+      strings_.push_back(str);
+    }
+    return it.first->second;
+  }
+  const std::vector<std::string>& strings() const { return strings_; }
+
+ private:
+  std::unordered_map<std::string, uint32_t> index_;
+  std::vector<std::string> strings_;
+};
+
+// The variable length fields of the nodes are stored in CSR form: the entries of node i are
+// entries[ptr[i], ptr[i + 1]), where ptr holds raw element offsets into entries.
+template <typename T, typename F>
+void WriteCSR(dmlc::Stream* strm, size_t size, F get_entries) {
+  std::vector<uint32_t> ptr{0};
+  std::vector<T> entries;
+  for (size_t i = 0; i < size; ++i) {
+    get_entries(i, &entries);
+    ptr.push_back(static_cast<uint32_t>(entries.size()));
+  }
+  strm->Write(ptr);
+  strm->Write(entries);
+}
+
+template <typename T>
+void ReadCSR(dmlc::Stream* strm, size_t size, std::vector<uint32_t>* ptr, std::vector<T>* entries) {
+  ICHECK(strm->Read(ptr)) << "Invalid binary graph";
+  ICHECK(strm->Read(entries)) << "Invalid binary graph";
+  ICHECK_EQ(ptr->size(), size + 1) << "Invalid binary graph";
+  ICHECK_EQ(ptr->front(), 0U) << "Invalid binary graph";
+  for (size_t i = 0; i < size; ++i) {
+    ICHECK_LE((*ptr)[i], (*ptr)[i + 1]) << "Invalid binary graph";
+  }
+  ICHECK_EQ(ptr->back(), entries->size()) << "Invalid binary graph";
+}
+}  // namespace
+
+void GraphExecutor::SaveBinary(dmlc::Stream* strm) const {
+  StringTable table;
+  std::vector<uint32_t> node_strings;  // op type, name and function name of each node
+  std::vector<uint32_t> node_params;   // num_inputs, num_outputs and flatten_data of each node
+  for (const Node& node : nodes_) {
+    node_strings.push_back(table.Intern(node.op_type));
+    node_strings.push_back(table.Intern(node.name));
+    node_strings.push_back(table.Intern(node.param.func_name));
+    bool is_op = node.op_type != "null";
+    node_params.push_back(is_op ? node.param.num_inputs : 0);
+    node_params.push_back(is_op ? node.param.num_outputs : 0);
+    node_params.push_back(is_op ? node.param.flatten_data : 0);
+  }
+  std::vector<uint32_t> dltype, storage_scope;
+  for (const std::string& type : attrs_.dltype) {
+    dltype.push_back(table.Intern(type));
+  }
+  for (const std::string& scope : attrs_.storage_scope) {
+    storage_scope.push_back(table.Intern(scope));
+  }
+  auto flatten_entries = [](const std::vector<NodeEntry>& entries, std::vector<uint32_t>* out) {
+    for (const NodeEntry& e : entries) {
+      out->insert(out->end(), {e.node_id, e.index, e.version});
+    }
+  };
+  // The attributes are interned before writing the table.
+  std::vector<std::vector<uint32_t>> node_attrs(nodes_.size());
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    for (const auto& kv : nodes_[i].param.attrs) {
+      node_attrs[i].push_back(table.Intern(kv.first));
+      node_attrs[i].push_back(table.Intern(Downcast<String>(kv.second)));
+    }
+  }
+
+  strm->Write(kTVMGraphBinaryMagic);
+  strm->Write(uint64_t(0));  // reserved
+  strm->Write(table.strings());
+  strm->Write(node_strings);
+  strm->Write(node_params);
+  WriteCSR<uint32_t>(strm, nodes_.size(), [&](size_t i, std::vector<uint32_t>* out) {
+    flatten_entries(nodes_[i].inputs, out);
+  });
+  WriteCSR<uint32_t>(strm, nodes_.size(), [&](size_t i, std::vector<uint32_t>* out) {
+    out->insert(out->end(), node_attrs[i].begin(), node_attrs[i].end());
+  });
+  WriteCSR<uint32_t>(strm, nodes_.size(), [&](size_t i, std::vector<uint32_t>* out) {
+    out->insert(out->end(), nodes_[i].control_deps.begin(), nodes_[i].control_deps.end());
+  });
+  strm->Write(input_nodes_);
+  strm->Write(node_row_ptr_);
+  std::vector<uint32_t> outputs;
+  flatten_entries(outputs_, &outputs);
+  strm->Write(outputs);
+  strm->Write(attrs_.storage_id);
+  strm->Write(attrs_.device_index);
+  strm->Write(dltype);
+  strm->Write(storage_scope);
+  WriteCSR<int64_t>(strm, attrs_.shape.size(), [&](size_t i, std::vector<int64_t>* out) {
+    out->insert(out->end(), attrs_.shape[i].begin(), attrs_.shape[i].end());
+  });
+}
+
+void GraphExecutor::LoadBinary(dmlc::Stream* strm) {
+  uint64_t header, reserved;
+  ICHECK(strm->Read(&header)) << "Invalid binary graph";
+  ICHECK_EQ(header, kTVMGraphBinaryMagic) << "Invalid binary graph";
+  ICHECK(strm->Read(&reserved)) << "Invalid binary graph";
+  std::vector<std::string> strings;
+  std::vector<uint32_t> node_strings, node_params;
+  ICHECK(strm->Read(&strings)) << "Invalid binary graph";
+  ICHECK(strm->Read(&node_strings)) << "Invalid binary graph";
+  ICHECK(strm->Read(&node_params)) << "Invalid binary graph";
+  ICHECK_EQ(node_strings.size() % 3, 0) << "Invalid binary graph";
+  size_t num_nodes = node_strings.size() / 3;
+  ICHECK_EQ(node_params.size(), num_nodes * 3) << "Invalid binary graph";
+  auto str = [&strings](uint32_t index) -> const std::string& {
+    ICHECK_LT(index, strings.size()) << "Invalid binary graph";
+    return strings[index];
+  };
+  auto node_id = [num_nodes](uint32_t nid) {
+    ICHECK_LT(nid, num_nodes) << "Invalid binary graph";
+    return nid;
+  };
+  auto unflatten_entries = [&node_id](const uint32_t* begin, const uint32_t* end) {
+    ICHECK_EQ((end - begin) % 3, 0) << "Invalid binary graph";
+    std::vector<NodeEntry> entries;
+    for (const uint32_t* it = begin; it != end; it += 3) {
+      entries.push_back(NodeEntry{node_id(it[0]), it[1], it[2]});
+    }
+    return entries;
+  };
+  std::vector<uint32_t> input_ptr, inputs, attr_ptr, attrs, dep_ptr, deps;
+  ReadCSR(strm, num_nodes, &input_ptr, &inputs);
+  ReadCSR(strm, num_nodes, &attr_ptr, &attrs);
+  ReadCSR(strm, num_nodes, &dep_ptr, &deps);
+  nodes_.resize(num_nodes);
+  for (size_t i = 0; i < num_nodes; ++i) {
+    Node& node = nodes_[i];
+    node.op_type = str(node_strings[i * 3]);
+    node.name = str(node_strings[i * 3 + 1]);
+    node.param.func_name = str(node_strings[i * 3 + 2]);
+    node.param.num_inputs = node_params[i * 3];
+    node.param.num_outputs = node_params[i * 3 + 1];
+    node.param.flatten_data = node_params[i * 3 + 2];
+    node.inputs = unflatten_entries(inputs.data() + input_ptr[i], inputs.data() + input_ptr[i + 1]);
+    ICHECK_EQ((attr_ptr[i + 1] - attr_ptr[i]) % 2, 0) << "Invalid binary graph";
+    for (uint32_t j = attr_ptr[i]; j < attr_ptr[i + 1]; j += 2) {
+      node.param.attrs[str(attrs[j])] = String(str(attrs[j + 1]));
+    }
+    node.control_deps.clear();
+    for (uint32_t j = dep_ptr[i]; j < dep_ptr[i + 1]; ++j) {
+      node.control_deps.push_back(node_id(deps[j]));
+    }
+  }
+  std::vector<uint32_t> outputs, dltype, storage_scope;
+  ICHECK(strm->Read(&input_nodes_)) << "Invalid binary graph";
+  for (uint32_t nid : input_nodes_) {
+    node_id(nid);
+  }
+  ICHECK(strm->Read(&node_row_ptr_)) << "Invalid binary graph";
+  ICHECK_EQ(node_row_ptr_.size(), num_nodes + 1) << "Invalid binary graph";
+  ICHECK_EQ(node_row_ptr_.front(), 0U) << "Invalid binary graph";
+  for (size_t i = 0; i < num_nodes; ++i) {
+    // A variable has one output, and its num_outputs is not stored.
+    uint32_t num_outputs = nodes_[i].op_type == "null" ? 1 : nodes_[i].param.num_outputs;
+    ICHECK_LE(node_row_ptr_[i], node_row_ptr_[i + 1]) << "Invalid binary graph";
+    ICHECK_EQ(node_row_ptr_[i + 1] - node_row_ptr_[i], num_outputs) << "Invalid binary graph";
+  }
+  auto check_entries = [this](const std::vector<NodeEntry>& entries) {
+    for (const NodeEntry& e : entries) {
+      ICHECK_LT(e.index, node_row_ptr_[e.node_id + 1] - node_row_ptr_[e.node_id])
+          << "Invalid binary graph";
+    }
+  };
+  for (const Node& node : nodes_) {
+    check_entries(node.inputs);
+  }
+  ICHECK(strm->Read(&outputs)) << "Invalid binary graph";
+  outputs_ = unflatten_entries(outputs.data(), outputs.data() + outputs.size());
+  check_entries(outputs_);
+  ICHECK(strm->Read(&attrs_.storage_id)) << "Invalid binary graph";
+  ICHECK(strm->Read(&attrs_.device_index)) << "Invalid binary graph";
+  ICHECK(strm->Read(&dltype)) << "Invalid binary graph";
+  ICHECK(strm->Read(&storage_scope)) << "Invalid binary graph";
+  for (uint32_t index : dltype) {
+    attrs_.dltype.push_back(str(index));
+  }
+  for (uint32_t index : storage_scope) {
+    attrs_.storage_scope.push_back(str(index));
+  }
+  std::vector<uint32_t> shape_ptr;
+  std::vector<int64_t> shapes;
+  ReadCSR(strm, attrs_.dltype.size(), &shape_ptr, &shapes);
+  for (size_t i = 0; i < attrs_.dltype.size(); ++i) {
+    attrs_.shape.emplace_back(shapes.begin() + shape_ptr[i], shapes.begin() + shape_ptr[i + 1]);
+  }
+  // The attributes are indexed by entry id. device_index and storage_scope are optional.
+  size_t num_entries = num_node_entries();
+  ICHECK_EQ(attrs_.storage_id.size(), num_entries) << "Invalid binary graph";
+  for (int storage_id : attrs_.storage_id) {
+    ICHECK_GE(storage_id, 0) << "Invalid binary graph";
+  }
+  ICHECK(attrs_.device_index.empty() || attrs_.device_index.size() == num_entries)
+      << "Invalid binary graph";
+  ICHECK_EQ(attrs_.dltype.size(), num_entries) << "Invalid binary graph";
+  ICHECK(attrs_.storage_scope.empty() || attrs_.storage_scope.size() == num_entries)
+      << "Invalid binary graph";
+  ICHECK_EQ(attrs_.shape.size(), num_entries) << "Invalid binary graph";
+}
+
+std::string GraphExecutor::GraphJSONToBinary(const std::string& graph_json) {
+  GraphExecutor exec;
+  std::istringstream is(graph_json);
+  dmlc::JSONReader reader(&is);
+  exec.Load(&reader);
+  std::string bytes;
+  dmlc::MemoryStringStream strm(&bytes);
+  exec.SaveBinary(&strm);
+  return bytes;
+}
+
 PackedFunc GraphExecutor::GetFunction(const String& name, const ObjectPtr<Object>& sptr_to_self) {
   // Return member functions during query.
   if (name == "set_input") {
@@ -665,10 +1058,18 @@ PackedFunc GraphExecutor::GetFunction(const String& name, const ObjectPtr<Object
       } else {
         in_idx = args[0];
       }
-      if (in_idx >= 0) {
-        *rv = this->GetInput(in_idx);
-      }
+      if (in_idx >= 0) *rv = this->GetInput(in_idx);
+    });
+  } else if (name == "set_param") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      this->SetParam(args[0].operator String(), args[1]);
     });
+  } else if (name == "enable_weight_packing") {
+    return PackedFunc(
+        [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { this->EnableWeightPacking(); });
+  } else if (name == "repack_weights") {
+    return PackedFunc(
+        [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { this->RepackWeights(); });
   } else if (name == "get_num_outputs") {
     return PackedFunc(
         [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { *rv = this->NumOutputs(); });
@@ -709,6 +1110,9 @@ PackedFunc GraphExecutor::GetFunction(const String& name, const ObjectPtr<Object
     return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
       this->LoadParams(args[0].operator std::string());
     });
+  } else if (name == "clone") {
+    return PackedFunc(
+        [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { *rv = this->Clone(); });
   } else if (name == "share_params") {
     return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
       const auto& module = args[0].operator Module();
@@ -783,5 +1187,14 @@ TVM_REGISTER_GLOBAL("tvm.graph_executor.create").set_body([](TVMArgs args, TVMRe
   const auto& devices = GetAllDevice(args, dev_start_arg);
   *rv = GraphExecutorCreate(args[0], args[1], devices, lookup_linked_param_func);
 });
+
+TVM_REGISTER_GLOBAL("tvm.graph_executor.graph_json_to_binary")
+    .set_body([](TVMArgs args, TVMRetValue* rv) {
+      std::string bytes = GraphExecutor::GraphJSONToBinary(args[0]);
+      TVMByteArray arr;
+      arr.data = bytes.c_str();
+      arr.size = bytes.length();
+      *rv = arr;
+    });
 }  // namespace runtime
 }  // namespace tvm
@@ -31,6 +31,7 @@
 #include <tvm/runtime/ndarray.h>
 #include <tvm/runtime/packed_func.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -49,6 +50,9 @@ namespace runtime {
     ICHECK_EQ(ret, 0) << TVMGetLastError(); \
   }
 
+/*! \brief Magic number of the compact binary graph format, see GraphExecutor::SaveBinary. */
+constexpr uint64_t kTVMGraphBinaryMagic = 0xF7E58D4F05049CB9;
+
 /*! \brief operator attributes about tvm op */
 struct TVMOpParam {
   std::string func_name;
@@ -139,6 +143,25 @@ class TVM_DLL GraphExecutor : public ModuleNode {
    * \param data_in The input data.
    */
   void SetInput(int index, DLTensor* data_in);
+  /*!
+   * \brief set the input of the graph holding a parameter, e.g. from GraphExecutorFactory.
+   *  Unlike SetInput, the input is recorded as a parameter, which Clone shares.
+   * \param name The name of the parameter.
+   * \param data_in The parameter data.
+   */
+  void SetParam(const std::string& name, DLTensor* data_in);
+  /*!
+   * \brief Run the nodes computed from parameters only, such as the layout transforms of weights
+   *  that were not folded at build time, once after the parameters change instead of on every
+   *  inference. The parameters must then be changed through SetInput or SetParam, or
+   *  RepackWeights must be called after writing to them in place, e.g. through GetInput.
+   */
+  void EnableWeightPacking();
+  /*!
+   * \brief Run the weight packing nodes again before the next inference, after the parameters
+   *  were written in place.
+   */
+  void RepackWeights();
   /*!
    * \brief set index-th input to the graph without copying the data
    * \param index The input index.
@@ -202,6 +225,16 @@ class TVM_DLL GraphExecutor : public ModuleNode {
    */
   void ShareParams(const GraphExecutor& other, dmlc::Stream* strm);
 
+  /*!
+   * \brief Create a new executor for the same graph, e.g. for another serving thread.
+   *  The graph, the functions looked up in the module and the parameters are shared, only the
+   *  storage of the activations and of the packed weights is allocated anew. Setting a
+   *  parameter on any of the executors changes it for all of them, and each of them packs the
+   *  weights again before its next inference.
+   * \return The new executor.
+   */
+  Module Clone() const;
+
   /*!
    * \brief Get total number of nodes.
    * \return Total number of nodes.
@@ -210,6 +243,21 @@ class TVM_DLL GraphExecutor : public ModuleNode {
 
   std::string GetNodeName(uint32_t nid) const { return nodes_[nid].name; }
 
+  /*!
+   * \brief Save the graph in the compact binary graph format, which Init accepts in place of
+   *  the graph JSON. All strings are interned into one table and the nodes are stored as flat
+   *  arrays, so loading needs no parsing.
+   * \param strm The output stream.
+   */
+  void SaveBinary(dmlc::Stream* strm) const;
+
+  /*!
+   * \brief Convert a graph JSON to the compact binary graph format.
+   * \param graph_json The graph JSON.
+   * \return The binary graph.
+   */
+  static std::string GraphJSONToBinary(const std::string& graph_json);
+
  protected:
   // Memory pool entry.
   struct PoolEntry {
@@ -416,6 +464,8 @@ class TVM_DLL GraphExecutor : public ModuleNode {
     }
     ICHECK_EQ(bitmask, 1 | 2 | 4 | 8 | 16) << "invalid format";
   }
+  /*! \brief Load the graph from the compact binary graph format, see SaveBinary. */
+  void LoadBinary(dmlc::Stream* strm);
   /*! \brief PackedFunc to lookup a linked paramter from a local Module. */
   void DefaultLookupLinkedParam(TVMArgs args, TVMRetValue* rv);
   /*! \brief Delete NDArray::Container with linked (i.e. static) data. */
@@ -424,6 +474,13 @@ class TVM_DLL GraphExecutor : public ModuleNode {
   void SetupStorage();
   /*! \brief Setup the executors. */
   void SetupOpExecs();
+  /*!
+   * \brief Find the nodes computed from parameters only, see EnableWeightPacking. Their
+   *  outputs get dedicated storage. Runs lazily on the first Run after parameters were set.
+   */
+  void SetupWeightPacking();
+  /*! \brief Run the weight packing nodes if the parameters changed since they last ran. */
+  void RunWeightPacking();
   /*!
    * \brief Check the legality of external DLTensor*.
    * \param external The external DLTensor*.
@@ -480,8 +537,31 @@ class TVM_DLL GraphExecutor : public ModuleNode {
   std::vector<size_t> data_alignment_;
   /*! \brief Operator on each node. */
   std::vector<std::function<void()>> op_execs_;
+  /*! \brief Functions looked up in the module by name, shared by the nodes calling them. */
+  std::unordered_map<std::string, PackedFunc> module_funcs_;
+  /*! \brief Whether weight packing is enabled, see EnableWeightPacking. */
+  bool weight_packing_{false};
+  /*! \brief Whether each node is a weight packing node, see SetupWeightPacking. */
+  std::vector<bool> weight_pack_node_;
+  /*! \brief Entry ids of the parameters and of the outputs of weight packing nodes. */
+  std::unordered_set<uint32_t> weight_eids_;
+  /*! \brief Whether the weight packing nodes need to run before the next inference. */
+  bool weight_pack_dirty_{false};
+  /*! \brief The version of the parameters, bumped on every change and shared with the clones. */
+  std::shared_ptr<std::atomic<uint64_t>> weight_version_{
+      std::make_shared<std::atomic<uint64_t>>(0)};
+  /*! \brief The version of the parameters the weights were last packed from. */
+  uint64_t packed_weight_version_{0};
+  /*! \brief Whether the parameters changed since SetupWeightPacking last ran. */
+  bool weight_pack_stale_{false};
+  /*! \brief Data of the inputs set by SetInputZeroCopy, by entry id. */
+  std::unordered_map<uint32_t, void*> zero_copy_inputs_;
+  /*! \brief Data of the outputs set by SetOutputZeroCopy, by entry id. */
+  std::unordered_map<uint32_t, void*> zero_copy_outputs_;
   /*! \brief Linked parameter lookup function. */
   PackedFunc lookup_linked_param_;
+  /*! \brief Whether lookup_linked_param_ was given to Init rather than the default one. */
+  bool custom_lookup_linked_param_{false};
   /*! \brief Module's _lookup_linked_param function, used by DefaultLookupLinkedParam. */
   PackedFunc module_lookup_linked_param_;
   /*!
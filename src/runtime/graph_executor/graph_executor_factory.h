@@ -120,9 +120,8 @@ class TVM_DLL GraphExecutorFactory : public runtime::ModuleNode {
                 return lhs_size > rhs_size;
               });
     for (const auto& key : keys) {
-      int in_idx = graph_executor->GetInputIndex(key);
-      if (in_idx >= 0) {
-        graph_executor->SetInput(in_idx, const_cast<DLTensor*>(value[key].operator->()));
+      if (graph_executor->GetInputIndex(key) >= 0) {
+        graph_executor->SetParam(key, const_cast<DLTensor*>(value[key].operator->()));
       }
     }
   }
@@ -200,6 +200,7 @@ DSOModule::DSOModule(const std::string& name) {
   TVM_INIT_CONTEXT_FUNC(TVMBackendAllocWorkspace);
   TVM_INIT_CONTEXT_FUNC(TVMBackendFreeWorkspace);
   TVM_INIT_CONTEXT_FUNC(TVMBackendParallelLaunch);
+  TVM_INIT_CONTEXT_FUNC(TVMBackendParallelDispatch);
 // TODO(tulloch): implement these functions?
 // TVM_INIT_CONTEXT_FUNC(TVMFuncCall);
 // TVM_INIT_CONTEXT_FUNC(TVMBackendGetFuncFromEnv);
@@ -53,3 +53,15 @@ int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, int num_ta
   flambda(0, &env, cdata);
   return 0;
 }
+
+int TVMBackendParallelDispatch(FTVMParallelLambda flambda, void* cdata, int num_task) {
+  TVMParallelGroupEnv env;
+  env.num_task = 1;
+  for (int task_id = 0; task_id < num_task; ++task_id) {
+    int res = flambda(task_id, &env, cdata);
+    if (res != 0) {
+      return res;
+    }
+  }
+  return 0;
+}
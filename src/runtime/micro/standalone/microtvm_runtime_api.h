@@ -45,6 +45,8 @@ typedef int (*FTVMParallelLambda)(int task_id, TVMParallelGroupEnv* penv, void*
 
 TVM_MICRO_RUNTIME_API_BACKEND_API int TVMBackendParallelLaunch(FTVMParallelLambda flambda,
                                                                void* cdata, int num_task);
+TVM_MICRO_RUNTIME_API_BACKEND_API int TVMBackendParallelDispatch(FTVMParallelLambda flambda,
+                                                                 void* cdata, int num_task);
 
 TVM_MICRO_RUNTIME_API_BACKEND_API void TVMAPISetLastError(const char* msg);
 TVM_MICRO_RUNTIME_API_BACKEND_API const char* TVMGetLastError(void);
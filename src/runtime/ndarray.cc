@@ -27,6 +27,7 @@
 #include <tvm/runtime/ndarray.h>
 #include <tvm/runtime/registry.h>
 
+#include "ndarray_utils.h"
 #include "runtime_base.h"
 
 extern "C" {
@@ -298,6 +299,14 @@ void NDArray::CopyFromTo(const DLTensor* from, DLTensor* to, TVMStreamHandle str
       << "Can not copy across different device types directly. From device type: "
       << from->device.device_type << " to device type: " << to->device.device_type;
 
+  // Host copies between different layouts are done elementwise on the thread pool, compact
+  // ones keep the plain memcpy of the device api.
+  if (from->device.device_type == kDLCPU && to->device.device_type == kDLCPU &&
+      (!runtime::IsContiguous(*from) || !runtime::IsContiguous(*to))) {
+    CPUCopyStrided(from, to);
+    return;
+  }
+
   // Use the device that is *not* a cpu device to get the correct device
   // api manager.
   Device dev = from->device.device_type != kDLCPU ? from->device : to->device;
@@ -0,0 +1,321 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file ndarray_utils.cc
+ * \brief Multithreaded host side copy, cast and fill kernels for NDArray.
+ */
+#include "ndarray_utils.h"
+
+#include <tvm/runtime/c_backend_api.h>
+#include <tvm/runtime/registry.h>
+#include <tvm/runtime/threading_backend.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace tvm {
+namespace runtime {
+
+namespace {
+
+/*! \brief Work below this number of bytes is not worth waking up the thread pool. */
+constexpr int64_t kParallelGrainBytes = 1 << 18;
+
+struct ParallelRangeClosure {
+  int64_t num_items;
+  const std::function<void(int64_t, int64_t)>* fwork;
+};
+
+int ParallelRangeLambda(int task_id, TVMParallelGroupEnv* penv, void* cdata) {
+  auto* closure = static_cast<ParallelRangeClosure*>(cdata);
+  int64_t step = (closure->num_items + penv->num_task - 1) / penv->num_task;
+  int64_t begin = std::min(task_id * step, closure->num_items);
+  int64_t end = std::min(begin + step, closure->num_items);
+  if (begin < end) (*closure->fwork)(begin, end);
+  return 0;
+}
+
+/*!
+ * \brief Split [0, num_items) into chunks processed by the runtime thread pool.
+ * \param num_items The number of items.
+ * \param item_bytes The approximate number of bytes touched per item.
+ * \param fwork The work callback on a half open range of items.
+ */
+void ParallelRange(int64_t num_items, int64_t item_bytes,
+                   const std::function<void(int64_t, int64_t)>& fwork) {
+  // Nested launches are not supported, callers already on the thread pool run the work inline.
+  if (num_items <= 1 || num_items * item_bytes < kParallelGrainBytes ||
+      threading::InParallelTask()) {
+    if (num_items > 0) fwork(0, num_items);
+    return;
+  }
+  ParallelRangeClosure closure{num_items, &fwork};
+  ICHECK_EQ(TVMBackendParallelLaunch(ParallelRangeLambda, &closure, 0), 0);
+}
+
+int64_t NumElements(const DLTensor* arr) {
+  int64_t size = 1;
+  for (int i = 0; i < arr->ndim; ++i) size *= arr->shape[i];
+  return size;
+}
+
+float BitsToFloat(uint32_t bits) {
+  float res;
+  std::memcpy(&res, &bits, sizeof(res));
+  return res;
+}
+
+uint32_t FloatToBits(float v) {
+  uint32_t bits;
+  std::memcpy(&bits, &v, sizeof(bits));
+  return bits;
+}
+
+/*!
+ * \brief Element conversions from and to float, one per supported storage dtype.
+ *
+ *  The half precision conversions select between their special cases with bit masks rather
+ *  than branches, so the cast loops are vectorized by the compiler.
+ */
+struct Float32 {
+  using T = float;
+  static float ToFloat(float v) { return v; }
+  static float FromFloat(float v) { return v; }
+};
+
+struct Float16 {
+  using T = uint16_t;
+  static float ToFloat(uint16_t v) {
+    constexpr uint32_t kExpMask = 0x7c00U << 13;
+    uint32_t bits = (static_cast<uint32_t>(v) & 0x7fffU) << 13;
+    uint32_t exp = bits & kExpMask;
+    // Rebias the exponent, then fix up infinity and NaN, and renormalize subnormals.
+    bits += (127U - 15) << 23;
+    uint32_t inf_nan = bits + ((128U - 16) << 23);
+    uint32_t subnormal = FloatToBits(BitsToFloat(bits + (1U << 23)) - BitsToFloat(113U << 23));
+    uint32_t is_inf_nan = 0U - static_cast<uint32_t>(exp == kExpMask);
+    uint32_t is_subnormal = 0U - static_cast<uint32_t>(exp == 0);
+    bits = (inf_nan & is_inf_nan) | (subnormal & is_subnormal) |
+           (bits & ~(is_inf_nan | is_subnormal));
+    return BitsToFloat(bits | ((static_cast<uint32_t>(v) & 0x8000U) << 16));
+  }
+  static uint16_t FromFloat(float v) {
+    constexpr uint32_t kF16Max = (127U + 16) << 23;
+    constexpr uint32_t kDenormMagic = ((127U - 15) + (23 - 10) + 1) << 23;
+    uint32_t bits = FloatToBits(v);
+    uint32_t sign = (bits >> 16) & 0x8000U;
+    bits &= 0x7fffffffU;
+    // Overflow goes to infinity, NaN stays a quiet NaN.
+    uint32_t inf_nan = bits > 0x7f800000U ? 0x7e00U : 0x7c00U;
+    // Subnormals are rounded by the float addition, normals round to nearest even.
+    uint32_t subnormal = FloatToBits(BitsToFloat(bits) + BitsToFloat(kDenormMagic)) - kDenormMagic;
+    uint32_t normal = (bits + ((15U - 127) << 23) + 0xfffU + ((bits >> 13) & 1U)) >> 13;
+    uint32_t is_inf_nan = 0U - static_cast<uint32_t>(bits >= kF16Max);
+    uint32_t is_subnormal = ~is_inf_nan & (0U - static_cast<uint32_t>(bits < (113U << 23)));
+    uint32_t res = (inf_nan & is_inf_nan) | (subnormal & is_subnormal) |
+                   (normal & ~(is_inf_nan | is_subnormal));
+    return static_cast<uint16_t>(res | sign);
+  }
+};
+
+struct BFloat16 {
+  using T = uint16_t;
+  static float ToFloat(uint16_t v) { return BitsToFloat(static_cast<uint32_t>(v) << 16); }
+  static uint16_t FromFloat(float v) {
+    uint32_t bits = FloatToBits(v);
+    // Round to nearest even, but keep NaN a quiet NaN instead of rounding it into infinity.
+    uint32_t rounded = (bits + 0x7fffU + ((bits >> 16) & 1U)) >> 16;
+    uint32_t nan = (bits >> 16) | 0x40U;
+    return static_cast<uint16_t>((bits & 0x7fffffffU) > 0x7f800000U ? nan : rounded);
+  }
+};
+
+template <typename IntType>
+struct Int {
+  using T = IntType;
+  static float ToFloat(IntType v) { return static_cast<float>(v); }
+  static IntType FromFloat(float v) {
+    if (std::isnan(v)) return 0;
+    float r = std::nearbyint(v);
+    r = std::min(r, static_cast<float>(std::numeric_limits<IntType>::max()));
+    r = std::max(r, static_cast<float>(std::numeric_limits<IntType>::min()));
+    return static_cast<IntType>(r);
+  }
+};
+
+/*! \brief Call f with the conversion traits matching dtype. */
+template <typename F>
+void DispatchDType(DLDataType dtype, F f) {
+  ICHECK_EQ(dtype.lanes, 1) << "Vector dtypes are not supported";
+  if (dtype.code == kDLFloat && dtype.bits == 32) {
+    f(Float32());
+  } else if (dtype.code == kDLFloat && dtype.bits == 16) {
+    f(Float16());
+  } else if (dtype.code == kDLBfloat && dtype.bits == 16) {
+    f(BFloat16());
+  } else if (dtype.code == kDLInt && dtype.bits == 8) {
+    f(Int<int8_t>());
+  } else if (dtype.code == kDLUInt && dtype.bits == 8) {
+    f(Int<uint8_t>());
+  } else {
+    LOG(FATAL) << "Unsupported dtype " << DLDataType2String(dtype);
+  }
+}
+
+template <typename Src, typename Dst>
+void CastRange(const typename Src::T* __restrict src, typename Dst::T* __restrict dst,
+               int64_t begin, int64_t end) {
+  // Fixed size blocks are vectorized even under the cheap cost model of -O2.
+  constexpr int64_t kBlock = 16;
+  int64_t i = begin;
+  for (; i + kBlock <= end; i += kBlock) {
+    for (int64_t j = 0; j < kBlock; ++j) {
+      dst[i + j] = Dst::FromFloat(Src::ToFloat(src[i + j]));
+    }
+  }
+  for (; i < end; ++i) {
+    dst[i] = Dst::FromFloat(Src::ToFloat(src[i]));
+  }
+}
+
+char* DataPtr(const DLTensor* arr) { return static_cast<char*>(arr->data) + arr->byte_offset; }
+
+}  // namespace
+
+void CPUCopyStrided(const DLTensor* from, DLTensor* to) {
+  const char* src = DataPtr(from);
+  char* dst = DataPtr(to);
+  if (IsContiguous(*from) && IsContiguous(*to)) {
+    size_t nbytes = GetDataSize(*from);
+    ICHECK_EQ(nbytes, GetDataSize(*to)) << "CPUCopyStrided: the size must exactly match";
+    ParallelRange(nbytes, 1, [src, dst](int64_t begin, int64_t end) {
+      std::memcpy(dst + begin, src + begin, end - begin);
+    });
+    return;
+  }
+
+  ICHECK_EQ(from->ndim, to->ndim) << "CPUCopyStrided: the shape must exactly match";
+  for (int i = 0; i < from->ndim; ++i) {
+    ICHECK_EQ(from->shape[i], to->shape[i]) << "CPUCopyStrided: the shape must exactly match";
+  }
+  ICHECK(DataType(from->dtype) == DataType(to->dtype))
+      << "CPUCopyStrided: the dtype must exactly match";
+
+  // Strides in bytes, compact strides for tensors without explicit ones.
+  int ndim = from->ndim;
+  int64_t elem_bytes = (from->dtype.bits * from->dtype.lanes + 7) / 8;
+  std::vector<int64_t> src_strides(ndim), dst_strides(ndim);
+  int64_t src_compact = elem_bytes, dst_compact = elem_bytes;
+  for (int i = ndim - 1; i >= 0; --i) {
+    src_strides[i] = from->strides ? from->strides[i] * elem_bytes : src_compact;
+    dst_strides[i] = to->strides ? to->strides[i] * elem_bytes : dst_compact;
+    src_compact *= from->shape[i];
+    dst_compact *= to->shape[i];
+  }
+
+  int64_t row_len = ndim == 0 ? 1 : from->shape[ndim - 1];
+  int64_t num_rows = row_len == 0 ? 0 : NumElements(from) / row_len;
+  bool row_contiguous = ndim == 0 || (src_strides[ndim - 1] == elem_bytes &&
+                                      dst_strides[ndim - 1] == elem_bytes);
+
+  ParallelRange(num_rows, row_len * elem_bytes, [&](int64_t begin, int64_t end) {
+    for (int64_t row = begin; row < end; ++row) {
+      // Unravel the row index over the outer dimensions.
+      int64_t src_offset = 0, dst_offset = 0;
+      int64_t rem = row;
+      for (int i = ndim - 2; i >= 0; --i) {
+        int64_t idx = rem % from->shape[i];
+        rem /= from->shape[i];
+        src_offset += idx * src_strides[i];
+        dst_offset += idx * dst_strides[i];
+      }
+      if (row_contiguous) {
+        std::memcpy(dst + dst_offset, src + src_offset, row_len * elem_bytes);
+      } else {
+        int64_t src_step = src_strides[ndim - 1], dst_step = dst_strides[ndim - 1];
+        for (int64_t j = 0; j < row_len; ++j) {
+          std::memcpy(dst + dst_offset + j * dst_step, src + src_offset + j * src_step, elem_bytes);
+        }
+      }
+    }
+  });
+}
+
+void CPUCast(const DLTensor* from, DLTensor* to) {
+  ICHECK(IsContiguous(*from) && IsContiguous(*to)) << "CPUCast only support contiguous array";
+  int64_t size = NumElements(from);
+  ICHECK_EQ(size, NumElements(to)) << "CPUCast: the number of elements must exactly match";
+  if (DataType(from->dtype) == DataType(to->dtype)) {
+    CPUCopyStrided(from, to);
+    return;
+  }
+  const void* src = DataPtr(from);
+  void* dst = DataPtr(to);
+  DispatchDType(from->dtype, [&](auto src_traits) {
+    using Src = decltype(src_traits);
+    DispatchDType(to->dtype, [&](auto dst_traits) {
+      using Dst = decltype(dst_traits);
+      const auto* src_ptr = static_cast<const typename Src::T*>(src);
+      auto* dst_ptr = static_cast<typename Dst::T*>(dst);
+      ParallelRange(size, sizeof(typename Src::T) + sizeof(typename Dst::T),
+                    [src_ptr, dst_ptr](int64_t begin, int64_t end) {
+                      CastRange<Src, Dst>(src_ptr, dst_ptr, begin, end);
+                    });
+    });
+  });
+}
+
+void CPUFill(DLTensor* arr, double value) {
+  ICHECK(IsContiguous(*arr)) << "CPUFill only support contiguous array";
+  int64_t size = NumElements(arr);
+  void* data = DataPtr(arr);
+  DispatchDType(arr->dtype, [&](auto traits) {
+    using Traits = decltype(traits);
+    auto* ptr = static_cast<typename Traits::T*>(data);
+    auto elem = Traits::FromFloat(static_cast<float>(value));
+    ParallelRange(size, sizeof(elem), [ptr, elem](int64_t begin, int64_t end) {
+      std::fill(ptr + begin, ptr + end, elem);
+    });
+  });
+}
+
+TVM_REGISTER_GLOBAL("runtime.NDArrayCopyStrided").set_body_typed([](NDArray from, NDArray to) {
+  ICHECK_EQ(from->device.device_type, kDLCPU);
+  ICHECK_EQ(to->device.device_type, kDLCPU);
+  CPUCopyStrided(from.operator->(), const_cast<DLTensor*>(to.operator->()));
+});
+
+TVM_REGISTER_GLOBAL("runtime.NDArrayCast").set_body_typed([](NDArray from, NDArray to) {
+  ICHECK_EQ(from->device.device_type, kDLCPU);
+  ICHECK_EQ(to->device.device_type, kDLCPU);
+  CPUCast(from.operator->(), const_cast<DLTensor*>(to.operator->()));
+});
+
+TVM_REGISTER_GLOBAL("runtime.NDArrayFill").set_body_typed([](NDArray arr, double value) {
+  ICHECK_EQ(arr->device.device_type, kDLCPU);
+  CPUFill(const_cast<DLTensor*>(arr.operator->()), value);
+});
+
+}  // namespace runtime
+}  // namespace tvm
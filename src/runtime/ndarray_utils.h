@@ -0,0 +1,68 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file ndarray_utils.h
+ * \brief Host side copy, cast and fill kernels for NDArray.
+ */
+#ifndef TVM_RUNTIME_NDARRAY_UTILS_H_
+#define TVM_RUNTIME_NDARRAY_UTILS_H_
+
+#include <tvm/runtime/ndarray.h>
+
+namespace tvm {
+namespace runtime {
+
+/*!
+ * \brief Copy between two CPU tensors with arbitrary strides.
+ *
+ *  Contiguous tensors only need to match in byte size and are copied with a
+ *  multithreaded memcpy. Otherwise the shape and dtype must match, and rows of
+ *  the innermost dimension are copied in parallel.
+ *
+ * \param from The source tensor.
+ * \param to The target tensor.
+ */
+void CPUCopyStrided(const DLTensor* from, DLTensor* to);
+
+/*!
+ * \brief Convert elements of a contiguous CPU tensor into another dtype.
+ *
+ *  Supported dtypes are float32, float16, bfloat16, int8 and uint8. Conversion
+ *  to floating point types rounds to nearest even, conversion to integer types
+ *  rounds to nearest and saturates.
+ *
+ * \param from The source tensor.
+ * \param to The target tensor, must have the same number of elements as from.
+ */
+void CPUCast(const DLTensor* from, DLTensor* to);
+
+/*!
+ * \brief Fill a contiguous CPU tensor with a scalar value.
+ *
+ *  Supported dtypes are the same as for CPUCast.
+ *
+ * \param arr The tensor to fill.
+ * \param value The value, converted to the dtype of arr.
+ */
+void CPUFill(DLTensor* arr, double value);
+
+}  // namespace runtime
+}  // namespace tvm
+#endif  // TVM_RUNTIME_NDARRAY_UTILS_H_
@@ -227,6 +227,11 @@ uint32_t Object::TypeKey2Index(const std::string& key) {
   return TypeContext::Global()->TypeKey2Index(key);
 }
 
+uint64_t& detail::ThreadLocalObjectAllocationCount() {
+  static thread_local uint64_t count = 0;
+  return count;
+}
+
 TVM_REGISTER_GLOBAL("runtime.ObjectPtrHash").set_body_typed([](ObjectRef obj) {
   return static_cast<int64_t>(ObjectPtrHash()(obj));
 });
@@ -130,6 +130,9 @@ class ParallelLauncher {
   // Whether this thread is worker of the pool.
   // used to prevent recursive launch.
   bool is_worker{false};
+  // Number of TVMBackendParallelDispatch tasks running on this thread.
+  // Parallel jobs launched from them run inline on this thread.
+  int dispatch_depth{0};
 
  private:
   // The pending jobs.
@@ -467,13 +470,17 @@ TVM_DLL void Configure(tvm::runtime::threading::ThreadGroup::AffinityMode mode,
 #endif
 }
 int32_t NumThreads() { return tvm::runtime::ThreadPool::ThreadLocal()->NumThreads(); }
+bool InParallelTask() {
+  ParallelLauncher* launcher = ParallelLauncher::ThreadLocal();
+  return launcher->is_worker || launcher->dispatch_depth > 0;
+}
 }  // namespace threading
 }  // namespace runtime
 }  // namespace tvm
 
 int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, int num_task) {
   int num_workers = tvm::runtime::threading::MaxConcurrency();
-  if (num_workers == 1) {
+  if (num_workers == 1 || tvm::runtime::ParallelLauncher::ThreadLocal()->dispatch_depth > 0) {
     std::atomic<int32_t> sync_counter{0};
     TVMParallelGroupEnv env;
     env.num_task = 1;
@@ -498,6 +505,60 @@ int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, int num_ta
   }
 }
 
+namespace {
+/*! \brief Closure of a TVMBackendParallelDispatch call. */
+struct ParallelDispatchClosure {
+  FTVMParallelLambda flambda;
+  void* cdata;
+  int num_task;
+};
+
+/*!
+ * \brief Runs the dispatched tasks assigned to one worker. Each task runs with a
+ * single-threaded group env, and parallel jobs it launches run inline.
+ */
+int ParallelDispatchWorker(int worker_id, TVMParallelGroupEnv* penv, void* cdata) {
+  auto* closure = static_cast<ParallelDispatchClosure*>(cdata);
+  tvm::runtime::ParallelLauncher* launcher = tvm::runtime::ParallelLauncher::ThreadLocal();
+  ++launcher->dispatch_depth;
+  int res = 0;
+  for (int task_id = worker_id; task_id < closure->num_task && res == 0;
+       task_id += penv->num_task) {
+    std::atomic<int32_t> sync_counter{0};
+    TVMParallelGroupEnv env;
+    env.num_task = 1;
+    env.sync_handle = &sync_counter;
+    res = (*closure->flambda)(task_id, &env, closure->cdata);
+  }
+  --launcher->dispatch_depth;
+  return res;
+}
+}  // namespace
+
+int TVMBackendParallelDispatch(FTVMParallelLambda flambda, void* cdata, int num_task) {
+  ParallelDispatchClosure closure{flambda, cdata, num_task};
+  int num_workers = std::min(num_task, tvm::runtime::threading::MaxConcurrency());
+  if (num_workers <= 1 || tvm::runtime::threading::InParallelTask()) {
+    TVMParallelGroupEnv env;
+    env.num_task = 1;
+    return ParallelDispatchWorker(0, &env, &closure);
+  }
+#if !TVM_THREADPOOL_USE_OPENMP
+  num_workers = std::min(num_workers, tvm::runtime::threading::NumThreads());
+  return tvm::runtime::ThreadPool::ThreadLocal()->Launch(ParallelDispatchWorker, &closure,
+                                                         num_workers, 0);
+#else
+  std::atomic<int> res{0};
+#pragma omp parallel num_threads(num_workers)
+  {
+    TVMParallelGroupEnv env;
+    env.num_task = num_workers;
+    if (ParallelDispatchWorker(omp_get_thread_num(), &env, &closure) != 0) res = -1;
+  }
+  return res.load();
+#endif
+}
+
 int TVMBackendParallelBarrier(int task_id, TVMParallelGroupEnv* penv) {
 #if TVM_THREADPOOL_USE_OPENMP
 #pragma omp barrier
@@ -97,7 +97,7 @@ void VirtualMachineDebug::LoadExecutable(const ObjectPtr<Executable>& exec) {
   }
 }
 
-void VirtualMachineDebug::OpStartHook(Instruction instr) {
+void VirtualMachineDebug::OpStartHook(const Instruction& instr) {
   if (prof_ && prof_.operator*().IsRunning()) {
     if (instr.op == Opcode::LoadConst) {
       Device dev = GetDevice(exec_->const_device_indexes[instr.const_index]);
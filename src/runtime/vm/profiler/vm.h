@@ -51,7 +51,7 @@ class VirtualMachineDebug : public VirtualMachine {
  private:
   void InvokePacked(Index packed_index, const PackedFunc& func, Index arg_count, Index output_size,
                     const std::vector<ObjectRef>& args) final;
-  void OpStartHook(Instruction instr) final;
+  void OpStartHook(const Instruction& instr) final;
   void OpStopHook() final;
 
   std::unordered_map<Index, std::string> packed_index_map_;
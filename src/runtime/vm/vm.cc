@@ -39,6 +39,18 @@
 
 #include "../file_utils.h"
 
+/*
+ * With GCC and Clang the interpreter loop uses computed gotos ("threaded code"): every opcode
+ * handler ends with its own indirect jump to the next handler, which the branch predictor
+ * learns per opcode rather than through a single shared switch. Debug builds keep the plain
+ * switch so the per-instruction VLOG trace is preserved.
+ */
+#if defined(__GNUC__) && !TVM_LOG_DEBUG && !defined(TVM_VM_DISABLE_THREADED_DISPATCH)
+#define TVM_VM_THREADED_DISPATCH 1
+#else
+#define TVM_VM_THREADED_DISPATCH 0
+#endif
+
 using namespace tvm::runtime;
 
 namespace tvm {
@@ -124,7 +136,7 @@ std::vector<int64_t> ToShape(NDArray shape_tensor) {
   return shape;
 }
 
-void VirtualMachine::OpStartHook(Instruction instr) {}
+void VirtualMachine::OpStartHook(const Instruction& instr) {}
 void VirtualMachine::OpStopHook() {}
 
 PackedFunc VirtualMachine::GetFunction(const String& name, const ObjectPtr<Object>& sptr_to_self) {
@@ -234,6 +246,10 @@ PackedFunc VirtualMachine::GetFunction(const String& name, const ObjectPtr<Objec
   } else if (name == "set_outputs") {
     return PackedFunc(
         [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { SetOutputs(args[0], args); });
+  } else if (name == "get_memoize_stats") {
+    // Returns (hits, misses) of the memoized shape function invocations.
+    return TypedPackedFunc<ShapeTuple(void)>(
+        [this]() { return ShapeTuple({memoize_hits_, memoize_misses_}); });
   } else if (name == "load_late_bound_consts") {
     return PackedFunc([this](TVMArgs args, TVMRetValue* rv) {
       CHECK_EQ(args.size(), 1);
@@ -491,6 +507,63 @@ void VirtualMachine::InvokePacked(Index packed_index, const PackedFunc& func, In
   }
 }
 
+void VirtualMachine::InvokeMemoizedPacked(Index packed_index, const PackedFunc& func,
+                                          Index arg_count, Index output_size,
+                                          const std::vector<ObjectRef>& args) {
+  // Bound on the number of distinct inputs remembered per packed function.
+  constexpr size_t kMaxMemoizedInputs = 256;
+
+  // Serialize the input contents into the memo key. Only host resident tensors qualify.
+  std::string key;
+  std::vector<NDArray> outputs;
+  for (Index i = 0; i < arg_count; ++i) {
+    const auto* array = args[i].as<NDArray::ContainerType>();
+    if (array == nullptr || array->dl_tensor.device.device_type != kDLCPU ||
+        !IsContiguous(array->dl_tensor)) {
+      InvokePacked(packed_index, func, arg_count, output_size, args);
+      return;
+    }
+    const DLTensor& tensor = array->dl_tensor;
+    if (i >= arg_count - output_size) {
+      outputs.push_back(Downcast<NDArray>(args[i]));
+      continue;
+    }
+    key.append(reinterpret_cast<const char*>(&tensor.dtype), sizeof(tensor.dtype));
+    key.append(reinterpret_cast<const char*>(&tensor.ndim), sizeof(tensor.ndim));
+    key.append(reinterpret_cast<const char*>(tensor.shape), sizeof(int64_t) * tensor.ndim);
+    key.append(static_cast<const char*>(tensor.data) + tensor.byte_offset, GetDataSize(tensor));
+  }
+
+  auto& memo = memoized_outputs_[packed_index];
+  auto it = memo.find(key);
+  if (it != memo.end()) {
+    const std::vector<std::string>& contents = it->second;
+    bool sizes_match = contents.size() == outputs.size();
+    for (size_t i = 0; sizes_match && i < outputs.size(); ++i) {
+      sizes_match = contents[i].size() == GetDataSize(*outputs[i].operator->());
+    }
+    if (sizes_match) {
+      for (size_t i = 0; i < outputs.size(); ++i) {
+        outputs[i].CopyFromBytes(contents[i].data(), contents[i].size());
+      }
+      ++memoize_hits_;
+      return;
+    }
+  }
+
+  InvokePacked(packed_index, func, arg_count, output_size, args);
+  ++memoize_misses_;
+
+  std::vector<std::string> contents;
+  for (const NDArray& output : outputs) {
+    const DLTensor* tensor = output.operator->();
+    contents.emplace_back(static_cast<const char*>(tensor->data) + tensor->byte_offset,
+                          GetDataSize(*tensor));
+  }
+  if (memo.size() >= kMaxMemoizedInputs) memo.clear();
+  memo[key] = std::move(contents);
+}
+
 void VirtualMachine::LoadExecutable(const ObjectPtr<Executable>& exec) {
   ICHECK(exec) << "The executable is not created yet.";
   ICHECK(exec->late_bound_constant_names.empty())
@@ -516,6 +589,18 @@ void VirtualMachine::LoadExecutable(const ObjectPtr<Executable>& exec) {
   for (size_t i = 0; i < packed_funcs_.size(); ++i) {
     ICHECK(packed_funcs_[i] != nullptr) << "Packed function " << i << " is not initialized";
   }
+
+  memoize_packed_.assign(packed_funcs_.size(), false);
+  memoized_outputs_.clear();
+  memoized_outputs_.resize(packed_funcs_.size());
+  memoize_hits_ = 0;
+  memoize_misses_ = 0;
+  for (const auto& it : exec_->op_attrs) {
+    auto packed_index = static_cast<size_t>(it.first);
+    if (packed_index < memoize_packed_.size() && it.second.count(kMemoizeAttr)) {
+      memoize_packed_[packed_index] = true;
+    }
+  }
 }
 
 void VirtualMachine::Init(const std::vector<Device>& physical_devices,
@@ -550,7 +635,9 @@ inline void VirtualMachine::WriteRegister(Index r, const ObjectRef& val) {
   frames_.back().register_file[r] = val;
 }
 
-ObjectRef VirtualMachine::ReadRegister(Index r) const { return frames_.back().register_file[r]; }
+const ObjectRef& VirtualMachine::ReadRegister(Index r) const {
+  return frames_.back().register_file[r];
+}
 
 int64_t VirtualMachine::LoadScalarInt(Index r) const {
   int64_t result = 0;
@@ -627,23 +714,51 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
   ICHECK(this->code_);
   pc_ = 0;
   Index frame_start = frames_.size();
+#if TVM_VM_THREADED_DISPATCH
+  // Indexed by opcode, see the Opcode enumeration.
+  static const void* const kDispatchTable[] = {
+      &&vm_opcode_Move,           &&vm_opcode_Ret,          &&vm_opcode_Invoke,
+      &&vm_opcode_InvokeClosure,  &&vm_opcode_InvokePacked, &&vm_opcode_AllocTensor,
+      &&vm_opcode_AllocTensorReg, &&vm_opcode_AllocADT,     &&vm_opcode_AllocClosure,
+      &&vm_opcode_GetField,       &&vm_opcode_If,           &&vm_opcode_LoadConst,
+      &&vm_opcode_Goto,           &&vm_opcode_GetTag,       &&vm_opcode_LoadConsti,
+      &&vm_opcode_Fatal,          &&vm_opcode_AllocStorage, &&vm_opcode_ShapeOf,
+      &&vm_opcode_ReshapeTensor,  &&vm_opcode_DeviceCopy,   &&vm_opcode_KillRegister,
+  };
+  constexpr size_t kNumOpcodes = sizeof(kDispatchTable) / sizeof(kDispatchTable[0]);
+  static_assert(kNumOpcodes == static_cast<size_t>(Opcode::KillRegister) + 1,
+                "kDispatchTable must have one entry per Opcode");
+#define TVM_VM_OPCODE(op) \
+  case Opcode::op:        \
+  vm_opcode_##op:
+#define TVM_VM_DISPATCH()                                         \
+  goto* (static_cast<size_t>(code_[pc_].op) < kNumOpcodes         \
+             ? kDispatchTable[static_cast<size_t>(code_[pc_].op)] \
+             : &&vm_opcode_unknown)
+#define TVM_VM_UNKNOWN_OPCODE() \
+  default:                      \
+  vm_opcode_unknown:
+#else
+#define TVM_VM_OPCODE(op) case Opcode::op:
+#define TVM_VM_DISPATCH() continue
+#define TVM_VM_UNKNOWN_OPCODE() default:
+#endif
+
   while (true) {
-  main_loop:
-    auto const& instr = code_[this->pc_];
-    VLOG(2) << "Executing(" << pc_ << "): " << instr;
-
-    switch (instr.op) {
-      case Opcode::Move: {
-        ObjectRef from_obj;
-        from_obj = ReadRegister(instr.from);
-        WriteRegister(instr.dst, from_obj);
+    VLOG(2) << "Executing(" << pc_ << "): " << code_[pc_];
+
+    switch (code_[pc_].op) {
+      TVM_VM_OPCODE(Move) {
+        auto const& instr = code_[pc_];
+        WriteRegister(instr.dst, ReadRegister(instr.from));
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::Fatal: {
+      TVM_VM_OPCODE(Fatal) {
         throw std::runtime_error("VM encountered fatal error");
       }
-      case Opcode::LoadConst: {
+      TVM_VM_OPCODE(LoadConst) {
+        auto const& instr = code_[pc_];
         bool is_not_cached = const_pool_.size() <= static_cast<size_t>(instr.const_index) ||
                              !const_pool_[instr.const_index].defined();
         if (is_not_cached) {
@@ -667,31 +782,36 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
           OpStopHook();
         }
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::LoadConsti: {
+      TVM_VM_OPCODE(LoadConsti) {
+        auto const& instr = code_[pc_];
         auto tensor = NDArray::Empty({1}, {kDLInt, 64, 1}, GetDevice(exec_->host_device_index));
         reinterpret_cast<int64_t*>(tensor->data)[0] = instr.load_consti.val;
         WriteRegister(instr.dst, tensor);
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::Invoke: {
+      TVM_VM_OPCODE(Invoke) {
+        auto const& instr = code_[pc_];
         std::vector<ObjectRef> args;
+        args.reserve(instr.num_args);
         for (Index i = 0; i < instr.num_args; ++i) {
           args.push_back(ReadRegister(instr.invoke_args_registers[i]));
         }
         InvokeGlobal(exec_->functions[instr.func_index], args);
         frames_.back().caller_return_register = instr.dst;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::InvokePacked: {
+      TVM_VM_OPCODE(InvokePacked) {
+        auto const& instr = code_[pc_];
         ICHECK_LE(instr.packed_index, packed_funcs_.size());
         const auto& func = packed_funcs_[instr.packed_index];
         const auto& arity = instr.arity;
         std::vector<ObjectRef> args;
+        args.reserve(arity);
         for (Index i = 0; i < arity; ++i) {
-          auto arg = ReadRegister(instr.packed_args[i]);
+          const auto& arg = ReadRegister(instr.packed_args[i]);
           args.push_back(arg);
 #if TVM_LOG_DEBUG
           if (i < arity) {
@@ -705,7 +825,11 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
 
         // We no longer need to write the registers back, we write directly
         // through the registers mutably.
-        InvokePacked(instr.packed_index, func, arity, instr.output_size, args);
+        if (memoize_packed_[instr.packed_index]) {
+          InvokeMemoizedPacked(instr.packed_index, func, arity, instr.output_size, args);
+        } else {
+          InvokePacked(instr.packed_index, func, arity, instr.output_size, args);
+        }
 
 #if TVM_LOG_DEBUG
         for (Index i = arity - instr.output_size; i < arity; ++i) {
@@ -716,14 +840,16 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
 #endif
 
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::InvokeClosure: {
+      TVM_VM_OPCODE(InvokeClosure) {
+        auto const& instr = code_[pc_];
         auto object = ReadRegister(instr.closure);
         const auto* closure = object.as<VMClosureObj>();
         ICHECK(closure);
         std::vector<ObjectRef> args;
-        for (auto free_var : closure->free_vars) {
+        args.reserve(closure->free_vars.size() + instr.num_closure_args);
+        for (const auto& free_var : closure->free_vars) {
           args.push_back(free_var);
         }
         for (Index i = 0; i < instr.num_closure_args; ++i) {
@@ -731,31 +857,35 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
         }
         InvokeGlobal(exec_->functions[closure->func_index], args);
         frames_.back().caller_return_register = instr.dst;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::GetField: {
-        auto object = ReadRegister(instr.object);
+      TVM_VM_OPCODE(GetField) {
+        auto const& instr = code_[pc_];
+        const auto& object = ReadRegister(instr.object);
         const auto& tuple = Downcast<ADT>(object);
         auto field = tuple[instr.field_index];
         WriteRegister(instr.dst, field);
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::GetTag: {
-        auto object = ReadRegister(instr.get_tag.object);
+      TVM_VM_OPCODE(GetTag) {
+        auto const& instr = code_[pc_];
+        const auto& object = ReadRegister(instr.get_tag.object);
         const auto& adt = Downcast<ADT>(object);
         auto tag = adt.tag();
         auto tag_tensor = NDArray::Empty({1}, {kDLInt, 32, 1}, GetDevice(exec_->host_device_index));
         reinterpret_cast<int32_t*>(tag_tensor->data)[0] = tag;
         WriteRegister(instr.dst, tag_tensor);
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::Goto: {
+      TVM_VM_OPCODE(Goto) {
+        auto const& instr = code_[pc_];
         pc_ += instr.pc_offset;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::If: {
+      TVM_VM_OPCODE(If) {
+        auto const& instr = code_[pc_];
         int32_t test_val = LoadScalarInt(instr.if_op.test);
         int32_t target_val = LoadScalarInt(instr.if_op.target);
 
@@ -767,9 +897,10 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
           pc_ += instr.if_op.false_offset;
         }
 
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::AllocTensor: {
+      TVM_VM_OPCODE(AllocTensor) {
+        auto const& instr = code_[pc_];
         OpStartHook(instr);
         if (!output_tensor_reg_indices.empty() && FindIndex(output_tensor_reg_indices, instr.dst)) {
           WriteAllocatedTensorFromOutside(instr);
@@ -778,9 +909,10 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
         }
         OpStopHook();
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::AllocTensorReg: {
+      TVM_VM_OPCODE(AllocTensorReg) {
+        auto const& instr = code_[pc_];
         OpStartHook(instr);
         Device cpu_dev = GetDevice(exec_->host_device_index);
         auto shape_obj = ReadRegister(instr.alloc_tensor_reg.shape_register);
@@ -797,9 +929,10 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
         WriteRegister(instr.dst, obj);
         OpStopHook();
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::AllocADT: {
+      TVM_VM_OPCODE(AllocADT) {
+        auto const& instr = code_[pc_];
         std::vector<ObjectRef> fields;
         for (Index i = 0; i < instr.num_fields; ++i) {
           fields.push_back(ReadRegister(instr.datatype_fields[i]));
@@ -807,18 +940,20 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
         ObjectRef obj = ADT(instr.constructor_tag, fields);
         WriteRegister(instr.dst, obj);
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::AllocClosure: {
+      TVM_VM_OPCODE(AllocClosure) {
+        auto const& instr = code_[pc_];
         std::vector<ObjectRef> free_vars;
         for (Index i = 0; i < instr.num_freevar; i++) {
           free_vars.push_back(ReadRegister(instr.free_vars[i]));
         }
         WriteRegister(instr.dst, VMClosure(instr.func_index, free_vars));
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::AllocStorage: {
+      TVM_VM_OPCODE(AllocStorage) {
+        auto const& instr = code_[pc_];
         OpStartHook(instr);
 
         auto storage_obj = SimpleObjAllocator().make_object<StorageObj>();
@@ -854,10 +989,11 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
         WriteRegister(instr.dst, storage);
         OpStopHook();
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::ShapeOf: {
-        auto input = ReadRegister(instr.shape_of.tensor);
+      TVM_VM_OPCODE(ShapeOf) {
+        auto const& instr = code_[pc_];
+        const auto& input = ReadRegister(instr.shape_of.tensor);
         NDArray input_array = Downcast<NDArray>(input);
         int ndim = input_array->ndim;
         auto out_tensor =
@@ -869,9 +1005,10 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
                 << RuntimeObject2String(out_tensor, GetDevice(exec_->host_device_index));
         WriteRegister(instr.dst, out_tensor);
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::Ret: {
+      TVM_VM_OPCODE(Ret) {
+        auto const& instr = code_[pc_];
         // If we have hit the point from which we started
         // running, we should return to the caller breaking
         // the dispatch loop.
@@ -883,10 +1020,11 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
           // Otherwise we are just returning from a local call.
         } else {
           WriteRegister(caller_return_register, return_register_);
-          goto main_loop;
+          TVM_VM_DISPATCH();
         }
       }
-      case Opcode::ReshapeTensor: {
+      TVM_VM_OPCODE(ReshapeTensor) {
+        auto const& instr = code_[pc_];
         OpStartHook(instr);
         Device cpu_dev = GetDevice(exec_->host_device_index);
         auto tensor_obj = ReadRegister(instr.reshape_tensor.tensor);
@@ -908,9 +1046,10 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
         WriteRegister(instr.dst, out_tensor);
         OpStopHook();
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::DeviceCopy: {
+      TVM_VM_OPCODE(DeviceCopy) {
+        auto const& instr = code_[pc_];
         OpStartHook(instr);
         auto tensor_src = ReadRegister(instr.device_copy.src);
         NDArray src_data = Downcast<NDArray>(tensor_src);
@@ -925,19 +1064,24 @@ void VirtualMachine::RunLoop(const std::vector<Index>& output_tensor_reg_indices
         WriteRegister(instr.dst, dst_data);
         OpStopHook();
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
       }
-      case Opcode::KillRegister: {
+      TVM_VM_OPCODE(KillRegister) {
+        auto const& instr = code_[pc_];
         OpStartHook(instr);
         WriteRegister(instr.dst, ObjectRef());
         OpStopHook();
         pc_++;
-        goto main_loop;
+        TVM_VM_DISPATCH();
+      }
+      TVM_VM_UNKNOWN_OPCODE() {
+        LOG(FATAL) << "Unknown instruction opcode: " << int(code_[pc_].op);
       }
-      default:
-        LOG(FATAL) << "Unknown instruction opcode: " << int(instr.op);
     }
   }
+#undef TVM_VM_DISPATCH
+#undef TVM_VM_OPCODE
+#undef TVM_VM_UNKNOWN_OPCODE
 }
 
 void VirtualMachine::WriteAllocatedTensor(const Instruction& instr) {
@@ -151,6 +151,10 @@
 #define TVM_INFO_USE_FALLBACK_STL_MAP "NOT-FOUND"
 #endif
 
+#ifndef TVM_INFO_USE_OBJECT_ALLOCATION_COUNT
+#define TVM_INFO_USE_OBJECT_ALLOCATION_COUNT "NOT-FOUND"
+#endif
+
 #ifndef TVM_INFO_USE_BYODT_POSIT
 #define TVM_INFO_USE_BYODT_POSIT "NOT-FOUND"
 #endif
@@ -324,6 +328,7 @@ TVM_DLL Map<String, String> GetLibInfo() {
       {"USE_MKL", TVM_INFO_USE_MKL},
       {"USE_MSVC_MT", TVM_INFO_USE_MSVC_MT},
       {"USE_NNPACK", TVM_INFO_USE_NNPACK},
+      {"USE_OBJECT_ALLOCATION_COUNT", TVM_INFO_USE_OBJECT_ALLOCATION_COUNT},
       {"USE_OPENCL", TVM_INFO_USE_OPENCL},
       {"USE_OPENCL_ENABLE_HOST_PTR", TVM_INFO_USE_OPENCL_ENABLE_HOST_PTR},
       {"USE_OPENCL_GTEST", TVM_INFO_USE_OPENCL_GTEST},
@@ -144,6 +144,7 @@ void CodeGenCPU::Init(const std::string& module_name, LLVMTarget* llvm_target,
   // int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, int num_task);
   ftype_tvm_parallel_launch_ = llvm::FunctionType::get(
       t_int_, {ftype_tvm_parallel_lambda_->getPointerTo(), t_void_p_, t_int_}, false);
+  // TVMBackendParallelDispatch in include/tvm/runtime/c_backend_api.h has the same signature.
   // Defined in include/tvm/runtime/c_backend_api.h:
   // int TVMBackendParallelBarrier(int task_id, TVMParallelGroupEnv* penv);
   ftype_tvm_parallel_barrier_ =
@@ -180,6 +181,9 @@ void CodeGenCPU::Init(const std::string& module_name, LLVMTarget* llvm_target,
     f_tvm_parallel_barrier_ =
         llvm::Function::Create(ftype_tvm_parallel_barrier_, llvm::Function::ExternalLinkage,
                                "TVMBackendParallelBarrier", module_.get());
+    f_tvm_parallel_dispatch_ =
+        llvm::Function::Create(ftype_tvm_parallel_launch_, llvm::Function::ExternalLinkage,
+                               "TVMBackendParallelDispatch", module_.get());
   }
   target_c_runtime_ = target_c_runtime;
   InitGlobalContext(dynamic_lookup);
@@ -538,6 +542,8 @@ void CodeGenCPU::InitGlobalContext(bool dynamic_lookup) {
           InitContextPtr(ftype_tvm_parallel_launch_->getPointerTo(), "__TVMBackendParallelLaunch");
       gv_tvm_parallel_barrier_ = InitContextPtr(ftype_tvm_parallel_barrier_->getPointerTo(),
                                                 "__TVMBackendParallelBarrier");
+      gv_tvm_parallel_dispatch_ = InitContextPtr(ftype_tvm_parallel_launch_->getPointerTo(),
+                                                 "__TVMBackendParallelDispatch");
       // Mark as context functions
       gv_func_map_["TVMBackendAllocWorkspace"] = nullptr;
       gv_func_map_["TVMBackendFreeWorkspace"] = nullptr;
@@ -685,7 +691,8 @@ void CodeGenCPU::UnpackClosureData(TypedPointer cdata, const Array<Var>& vfields
   }
 }
 
-void CodeGenCPU::CreateParallelLaunch(const Stmt& body, int num_task, std::string name) {
+void CodeGenCPU::CreateParallelLaunch(const Stmt& body, int num_task, std::string name,
+                                      Optional<Var> dispatch_task_id) {
   // closure data
   llvm::Function* f =
       llvm::Function::Create(ftype_tvm_parallel_lambda_, llvm::Function::PrivateLinkage,
@@ -693,13 +700,16 @@ void CodeGenCPU::CreateParallelLaunch(const Stmt& body, int num_task, std::strin
   SetTargetAttributes(f);
 
   // allocate and setup the closure, call the closure.
-  Array<Var> vfields = tir::UndefinedVars(body, {});
+  Array<Var> vfields = dispatch_task_id ? tir::UndefinedVars(body, {dispatch_task_id.value()})
+                                        : tir::UndefinedVars(body, {});
   uint64_t nbytes;
   TypedPointer cdata = PackClosureData(vfields, &nbytes, "closure_" + name);
+  llvm::Value* launch_func =
+      dispatch_task_id ? RuntimeTVMParallelDispatch() : RuntimeTVMParallelLaunch();
 #if TVM_LLVM_VERSION >= 90
-  auto launch_callee = llvm::FunctionCallee(ftype_tvm_parallel_launch_, RuntimeTVMParallelLaunch());
+  auto launch_callee = llvm::FunctionCallee(ftype_tvm_parallel_launch_, launch_func);
 #else
-  auto launch_callee = RuntimeTVMParallelLaunch();
+  auto launch_callee = launch_func;
 #endif
   llvm::BasicBlock* par_launch_end = CheckCallSuccess(builder_->CreateCall(
       launch_callee,
@@ -716,16 +726,22 @@ void CodeGenCPU::CreateParallelLaunch(const Stmt& body, int num_task, std::strin
   // setup new variable map, swap it with current var context.
   std::unordered_map<const VarNode*, llvm::Value*> new_vmap;
   UnpackClosureData(cdata, vfields, &new_vmap);
-  // setup parallel env
   ParallelEnv par_env;
-  par_env.task_id = Var("task_id", DataType::Int(32));
-  par_env.num_task = Var("num_task", DataType::Int(32));
-  new_vmap[par_env.task_id.get()] = task_id;
-  new_vmap[par_env.num_task.get()] = builder_->CreateLoad(
-      t_int32_,
-      builder_->CreateInBoundsGEP(t_tvm_parallel_group_env_, penv, {ConstInt32(0), ConstInt32(1)}),
-      "num_task");
-  par_env.penv = penv;
+  if (dispatch_task_id) {
+    // dispatched tasks run the body once with their task id, outside of any parallel env
+    new_vmap[dispatch_task_id.value().get()] = task_id;
+  } else {
+    // setup parallel env
+    par_env.task_id = Var("task_id", DataType::Int(32));
+    par_env.num_task = Var("num_task", DataType::Int(32));
+    new_vmap[par_env.task_id.get()] = task_id;
+    new_vmap[par_env.num_task.get()] = builder_->CreateLoad(
+        t_int32_,
+        builder_->CreateInBoundsGEP(t_tvm_parallel_group_env_, penv,
+                                    {ConstInt32(0), ConstInt32(1)}),
+        "num_task");
+    par_env.penv = penv;
+  }
   auto new_analyzer = std::make_unique<arith::Analyzer>();
   std::swap(function_, f);
   std::swap(parallel_env_, par_env);
@@ -738,7 +754,8 @@ void CodeGenCPU::CreateParallelLaunch(const Stmt& body, int num_task, std::strin
   std::swap(analyzer_, new_analyzer);
   std::swap(parallel_env_, par_env);
   std::swap(function_, f);
-  ICHECK_NE(par_env.parallel_loop_count, 0) << "Cannot find parallel loop within parallel launch";
+  ICHECK(dispatch_task_id || par_env.parallel_loop_count != 0)
+      << "Cannot find parallel loop within parallel launch";
   builder_->SetInsertPoint(par_launch_end);
 }
 
@@ -1030,6 +1047,11 @@ llvm::Value* CodeGenCPU::RuntimeTVMParallelBarrier() {
   return GetContextPtr(gv_tvm_parallel_barrier_);
 }
 
+llvm::Value* CodeGenCPU::RuntimeTVMParallelDispatch() {
+  if (f_tvm_parallel_dispatch_ != nullptr) return f_tvm_parallel_dispatch_;
+  return GetContextPtr(gv_tvm_parallel_dispatch_);
+}
+
 /*! \brief Defines LLVM Types for each Metadata member type. */
 struct MetadataLlvmTypes {
   llvm::Type* t_float64;
@@ -1515,6 +1537,11 @@ void CodeGenCPU::VisitStmt_(const AttrStmtNode* op) {
     this->CreateStaticInit(value->value, op->body);
   } else if (op->attr_key == tir::attr::compute_scope) {
     this->CreateComputeScope(op);
+  } else if (op->attr_key == tir::attr::parallel_dispatch) {
+    const auto* num_task = op->value.as<IntImmNode>();
+    ICHECK(num_task != nullptr) << "parallel_dispatch expects a constant number of tasks";
+    CreateParallelLaunch(op->body, num_task->value, "parallel_dispatch",
+                         Downcast<Var>(op->node));
   } else if (tir::attr::IsPragmaKey(op->attr_key)) {
     if (op->attr_key == "pragma_parallel_stride_pattern") {
       ICHECK(parallel_env_.penv != nullptr)
@@ -136,6 +136,7 @@ class CodeGenCPU : public CodeGenLLVM {
   llvm::Value* RuntimeTVMAPISetLastError();
   llvm::Value* RuntimeTVMParallelLaunch();
   llvm::Value* RuntimeTVMParallelBarrier();
+  llvm::Value* RuntimeTVMParallelDispatch();
   llvm::Value* CreateStaticHandle();
   llvm::Value* GetPackedFuncHandle(const std::string& str);
   TypedPointer PackClosureData(const Array<Var>& fields, uint64_t* num_bytes,
@@ -157,8 +158,10 @@ class CodeGenCPU : public CodeGenLLVM {
   llvm::Value* CreateCallTracePacked(const CallNode* op);
   // Create static initialization
   void CreateStaticInit(const std::string& init_fname, const Stmt& body);
-  // Create parallel launch
-  void CreateParallelLaunch(const Stmt& body, int num_task, std::string name = "");
+  // Create parallel launch, or a parallel dispatch of num_task tasks binding
+  // dispatch_task_id when it is defined.
+  void CreateParallelLaunch(const Stmt& body, int num_task, std::string name = "",
+                            Optional<Var> dispatch_task_id = NullOpt);
   // Create a new compute scope.
   void CreateComputeScope(const AttrStmtNode* op);
   // Check if the call to packed function is successful
@@ -173,6 +176,7 @@ class CodeGenCPU : public CodeGenLLVM {
   llvm::GlobalVariable* gv_tvm_api_set_last_error_{nullptr};
   llvm::GlobalVariable* gv_tvm_parallel_launch_{nullptr};
   llvm::GlobalVariable* gv_tvm_parallel_barrier_{nullptr};
+  llvm::GlobalVariable* gv_tvm_parallel_dispatch_{nullptr};
   std::unordered_map<String, llvm::GlobalVariable*> gv_func_map_;
   // context for direct dynamic lookup
   llvm::Function* f_tvm_func_call_{nullptr};
@@ -180,6 +184,7 @@ class CodeGenCPU : public CodeGenLLVM {
   llvm::Function* f_tvm_api_set_last_error_{nullptr};
   llvm::Function* f_tvm_parallel_launch_{nullptr};
   llvm::Function* f_tvm_parallel_barrier_{nullptr};
+  llvm::Function* f_tvm_parallel_dispatch_{nullptr};
   llvm::Function* f_tvm_register_system_symbol_{nullptr};
   // Current parallel environment scope.
   ParallelEnv parallel_env_;
@@ -1377,6 +1377,35 @@ llvm::Value* CodeGenLLVM::CreateIntrinsic(const CallNode* op) {
     TypedPointer buffer_ptr = CreateBufferPtr(MakeValue(load->buffer->data), load->buffer->dtype,
                                               indices_val, load->dtype);
     return buffer_ptr.addr;
+  } else if (op->op.same_as(builtin::masked_load())) {
+    ICHECK_EQ(op->args.size(), 2U);
+    llvm::Type* vtype = DTypeToLLVMType(op->dtype);
+    llvm::Value* addr = MakeValue(op->args[0]);
+    unsigned addrspace = llvm::dyn_cast<llvm::PointerType>(addr->getType())->getAddressSpace();
+    addr = builder_->CreatePointerCast(addr, vtype->getPointerTo(addrspace));
+    llvm::Value* mask = MakeValue(op->args[1]);
+    llvm::Value* passthru = llvm::Constant::getNullValue(vtype);
+    int alignment = op->dtype.element_of().bytes();
+#if TVM_LLVM_VERSION >= 130
+    return builder_->CreateMaskedLoad(vtype, addr, llvm::Align(alignment), mask, passthru);
+#elif TVM_LLVM_VERSION >= 110
+    return builder_->CreateMaskedLoad(addr, llvm::Align(alignment), mask, passthru);
+#else
+    return builder_->CreateMaskedLoad(addr, alignment, mask, passthru);
+#endif
+  } else if (op->op.same_as(builtin::masked_store())) {
+    ICHECK_EQ(op->args.size(), 3U);
+    llvm::Value* value = MakeValue(op->args[1]);
+    llvm::Value* addr = MakeValue(op->args[0]);
+    unsigned addrspace = llvm::dyn_cast<llvm::PointerType>(addr->getType())->getAddressSpace();
+    addr = builder_->CreatePointerCast(addr, value->getType()->getPointerTo(addrspace));
+    llvm::Value* mask = MakeValue(op->args[2]);
+    int alignment = op->args[1].dtype().element_of().bytes();
+#if TVM_LLVM_VERSION >= 110
+    return builder_->CreateMaskedStore(value, addr, llvm::Align(alignment), mask);
+#else
+    return builder_->CreateMaskedStore(value, addr, alignment, mask);
+#endif
   } else if (op->op.same_as(builtin::reinterpret()) && is_zero(op->args[0])) {
     return llvm::Constant::getNullValue(t_void_p_);
   } else if (op->op.same_as(builtin::isnullptr())) {
@@ -33,6 +33,8 @@
 #include <llvm/Support/Casting.h>
 #include <llvm/Target/TargetMachine.h>
 #include <tvm/runtime/registry.h>
+#include <tvm/tir/builtin.h>
+#include <tvm/tir/stmt_functor.h>
 
 #include <string>
 #include <vector>
@@ -73,10 +75,154 @@ bool TargetHasFeature(const llvm::TargetMachine& tm, const std::string& feature)
   // return checkFeatures(MCInfo, std::string("+") + feature);
 #endif
 }
+
+#if TVM_LLVM_VERSION >= 120
+/*!
+ * \brief Load the AMX tile configuration in front of the code using tile registers.
+ *
+ * The tile configuration is per-thread state, so it is loaded at the start of every
+ * outermost parallel loop body (each one is run as a task on a pool thread), and at the
+ * start of the function body when tiles are also used outside of parallel loops. Every
+ * tile is configured as 16 rows x 64 bytes, which is what the AMX tensor intrinsics use.
+ */
+class AMXTileConfigInjector : public tir::StmtMutator {
+ public:
+  static tir::Stmt Inject(tir::Stmt body) {
+    if (!UsesTiles(body)) {
+      return body;
+    }
+    AMXTileConfigInjector injector;
+    body = injector(std::move(body));
+    if (UsesTilesOutsideParallel(body)) {
+      body = WithTileConfig(body);
+    }
+    return body;
+  }
+
+ private:
+  static bool IsTileIntrin(const tir::CallNode* op) {
+    if (!op->op.same_as(tir::builtin::call_llvm_intrin()) || op->args.empty()) {
+      return false;
+    }
+    const auto* id = op->args[0].as<IntImmNode>();
+    if (id == nullptr) {
+      return false;
+    }
+    switch (static_cast<llvm::Intrinsic::ID>(id->value)) {
+      case llvm::Intrinsic::x86_tileloadd64:
+      case llvm::Intrinsic::x86_tileloaddt164:
+      case llvm::Intrinsic::x86_tilestored64:
+      case llvm::Intrinsic::x86_tilezero:
+      case llvm::Intrinsic::x86_tdpbssd:
+      case llvm::Intrinsic::x86_tdpbsud:
+      case llvm::Intrinsic::x86_tdpbusd:
+      case llvm::Intrinsic::x86_tdpbuud:
+      case llvm::Intrinsic::x86_tdpbf16ps:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  static bool UsesTiles(const tir::Stmt& stmt) {
+    bool found = false;
+    tir::PostOrderVisit(stmt, [&found](const ObjectRef& node) {
+      if (const auto* call = node.as<tir::CallNode>()) {
+        found = found || IsTileIntrin(call);
+      }
+    });
+    return found;
+  }
+
+  static bool UsesTilesOutsideParallel(const tir::Stmt& stmt) {
+    struct Visitor : public tir::StmtExprVisitor {
+      void VisitStmt_(const tir::ForNode* op) final {
+        // Parallel loops using tiles have been configured already.
+        if (op->kind != tir::ForKind::kParallel) {
+          tir::StmtExprVisitor::VisitStmt_(op);
+        }
+      }
+      void VisitExpr_(const tir::CallNode* op) final {
+        found = found || IsTileIntrin(op);
+        tir::StmtExprVisitor::VisitExpr_(op);
+      }
+      bool found = false;
+    } visitor;
+    visitor(stmt);
+    return visitor.found;
+  }
+
+  static tir::Stmt WithTileConfig(const tir::Stmt& body) {
+    // Layout of the 64-byte tile configuration: palette id at byte 0, the bytes per row
+    // of tmm0-7 as uint16 at bytes 16-31 and the number of rows of tmm0-7 at bytes 48-55.
+    constexpr int kConfigBytes = 64;
+    DataType u8 = DataType::UInt(8);
+    tir::Buffer config =
+        tir::decl_buffer({IntImm(DataType::Int(32), kConfigBytes)}, u8, "amx_tile_config");
+    auto store = [&](int index, int value) {
+      return tir::BufferStore(config, IntImm(u8, value), {IntImm(DataType::Int(32), index)});
+    };
+    Array<tir::Stmt> seq;
+    for (int i = 0; i < kConfigBytes; ++i) {
+      int value = 0;
+      if (i == 0) {
+        value = 1;
+      } else if (i >= 16 && i < 32 && i % 2 == 0) {
+        value = 64;
+      } else if (i >= 48 && i < 56) {
+        value = 16;
+      }
+      seq.push_back(store(i, value));
+    }
+    auto intrin = [](llvm::Intrinsic::ID id, Array<PrimExpr> args) {
+      args.insert(args.begin(), IntImm(DataType::UInt(32), 0));
+      args.insert(args.begin(), IntImm(DataType::UInt(32), id));
+      return tir::Evaluate(tir::Call(DataType::Int(32), tir::builtin::call_llvm_intrin(), args));
+    };
+    seq.push_back(intrin(llvm::Intrinsic::x86_ldtilecfg,
+                         {config.access_ptr(/*access_mask=*/1, DataType::Handle())}));
+    seq.push_back(body);
+    seq.push_back(intrin(llvm::Intrinsic::x86_tilerelease, {}));
+    return tir::Allocate(config->data, u8, config->shape, const_true(), tir::SeqStmt(seq));
+  }
+
+  tir::Stmt VisitStmt_(const tir::ForNode* op) final {
+    if (op->kind == tir::ForKind::kParallel && UsesTiles(op->body)) {
+      tir::For loop = GetRef<tir::For>(op);
+      loop.CopyOnWrite()->body = WithTileConfig(op->body);
+      return std::move(loop);
+    }
+    return tir::StmtMutator::VisitStmt_(op);
+  }
+};
+
+/*!
+ * \brief Linux only lets a process use the AMX tile data after requesting it, the first tile
+ *  instruction faults otherwise. Request it through the runtime helper runtime.amx_init (built
+ *  with USE_AMX) before the body, and fail the call unless the helper reports success.
+ */
+tir::Stmt WithAMXInit(const tir::Stmt& body) {
+  tir::Var stack_value("amx_init_value", DataType::Handle());
+  tir::Var stack_tcode("amx_init_tcode", DataType::Handle());
+  // No argument, the return value takes the first slot.
+  PrimExpr init = tir::Call(DataType::Int(32), tir::builtin::tvm_call_packed_lowered(),
+                            {tir::StringImm("runtime.amx_init"), stack_value, stack_tcode,
+                             IntImm(DataType::Int(32), 0), IntImm(DataType::Int(32), 0)});
+  auto stack_alloca = [](const char* type) {
+    return tir::Call(DataType::Handle(), tir::builtin::tvm_stack_alloca(),
+                     {tir::StringImm(type), IntImm(DataType::Int(32), 1)});
+  };
+  tir::Stmt stmt = tir::AssertStmt(
+      init == 1, tir::StringImm("Failed to request the permission to use the AMX tile data"), body);
+  stmt = tir::LetStmt(stack_tcode, stack_alloca("arg_tcode"), stmt);
+  return tir::LetStmt(stack_value, stack_alloca("arg_value"), stmt);
+}
+#endif
 }  // namespace
 
 class CodeGenX86_64 final : public CodeGenCPU {
  public:
+  void AddFunction(const GlobalVar& gvar, const PrimFunc& f) override;
   llvm::Value* VisitExpr_(const CastNode* op) override;
 
  private:
@@ -84,6 +230,22 @@ class CodeGenX86_64 final : public CodeGenCPU {
                                 const std::vector<llvm::Value*>& args);
 };
 
+void CodeGenX86_64::AddFunction(const GlobalVar& gvar, const PrimFunc& f) {
+#if TVM_LLVM_VERSION >= 120
+  tir::Stmt body = AMXTileConfigInjector::Inject(f->body);
+  if (!body.same_as(f->body)) {
+    if (llvm_target_->GetOrCreateTargetMachine()->getTargetTriple().isOSLinux()) {
+      body = WithAMXInit(body);
+    }
+    PrimFunc func = f;
+    func.CopyOnWrite()->body = body;
+    CodeGenCPU::AddFunction(gvar, func);
+    return;
+  }
+#endif
+  CodeGenCPU::AddFunction(gvar, f);
+}
+
 llvm::Value* CodeGenX86_64::VisitExpr_(const CastNode* op) {
   // LLVM does not automatically generate the correct instruction sequences for
   // half -> float conversion (i.e. using AVX2/AVX-512 vectorized variants of
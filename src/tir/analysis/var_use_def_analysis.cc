@@ -47,6 +47,9 @@ void VarUseDefAnalyzer::VisitStmt_(const AttrStmtNode* op) {
     }
 
     this->VisitStmt(op->body);
+  } else if (op->attr_key == attr::parallel_dispatch) {
+    this->HandleDef(Downcast<Var>(op->node));
+    StmtExprVisitor::VisitStmt_(op);
   } else {
     StmtExprVisitor::VisitStmt_(op);
   }
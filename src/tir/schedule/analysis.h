@@ -675,6 +675,22 @@ bool NeedsMultiLevelTiling(const ScheduleState& self, const StmtSRef& block_sref
  */
 bool IsSpatialPrimFunc(const PrimFunc& func);
 
+/*!
+ * \brief Checks if the block is the root block of its PrimFunc
+ * \param sch The schedule
+ * \param block_rv The block to be checked
+ * \return A boolean indicating whether the block is the root block
+ */
+bool IsRootBlock(const Schedule& sch, const BlockRV& block_rv);
+
+/*!
+ * \brief Checks if all the blocks in the PrimFunc containing the root block are spatial
+ * \param sch The schedule
+ * \param root_block_rv The root block of the PrimFunc
+ * \return A boolean indicating whether all the blocks in the PrimFunc are spatial
+ */
+bool CheckSpatialPrimFunc(const Schedule& sch, const BlockRV& root_block_rv);
+
 /*!
  * \brief Checks if the rfactor or cross thread reduction is beneficial to the given block.
  * \param self The schedule state.
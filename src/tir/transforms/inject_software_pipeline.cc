@@ -62,6 +62,52 @@ Block MakeBlock(const Stmt& body, const Map<Var, Buffer>& buffer_data_to_buffer)
   return block;
 }
 
+/*!
+ * \brief Prefetch every cache line of a buffer region with constant extents.
+ * \param region The region to be prefetched.
+ * \return The prefetch loop nest, or NullOpt if the region is not constant or too large.
+ */
+Optional<Stmt> MakeRegionPrefetch(const BufferRegion& region) {
+  // Tiles larger than this are beyond the L2 cache, where prefetching them only adds overhead.
+  constexpr int64_t kMaxPrefetchLines = 1024;
+  constexpr int64_t kCacheLineBytes = 64;
+  const Buffer& buffer = region->buffer;
+  int64_t elems_per_line = std::max<int64_t>(1, kCacheLineBytes / buffer->dtype.bytes());
+  int ndim = region->region.size();
+  Array<PrimExpr> indices;
+  std::vector<std::pair<Var, int64_t>> loops;
+  int64_t num_lines = 1;
+  for (int i = 0; i < ndim; ++i) {
+    const Range& range = region->region[i];
+    const auto* extent = range->extent.as<IntImmNode>();
+    if (extent == nullptr) {
+      return NullOpt;
+    }
+    // The last dimension is contiguous, so it is prefetched one cache line at a time.
+    int64_t step = i == ndim - 1 ? elems_per_line : 1;
+    int64_t n = (extent->value + step - 1) / step;
+    num_lines *= n;
+    if (n == 1) {
+      indices.push_back(range->min);
+    } else {
+      Var var("prefetch_i" + std::to_string(i), range->min.dtype());
+      loops.emplace_back(var, n);
+      indices.push_back(range->min + var * make_const(var.dtype(), step));
+    }
+  }
+  if (num_lines > kMaxPrefetchLines) {
+    return NullOpt;
+  }
+  PrimExpr addr = Call(DataType::Handle(), builtin::address_of(), {BufferLoad(buffer, indices)});
+  Stmt body = Evaluate(Call(buffer->dtype, builtin::prefetch(), {addr, 0, 3, 1}));
+  for (auto it = loops.rbegin(); it != loops.rend(); ++it) {
+    DataType dtype = it->first.dtype();
+    body = For(it->first, make_const(dtype, 0), make_const(dtype, it->second), ForKind::kSerial,
+               body);
+  }
+  return body;
+}
+
 /*! Structure that represents the provided annotation per block or loop. */
 struct PipelineAnnotation {
   int stage;
@@ -316,9 +362,10 @@ class PipelineRewriter : public StmtExprMutator {
       const Array<Buffer> pipeline_allocs, const For& pipeline_loop,
       const PipelineInfo& pipeline_info,
       const std::unordered_map<const VarNode*, FragmentInfo>& fragment_info,
-      const Map<String, ObjectRef> preserved_annotations) {
+      const Map<String, ObjectRef> preserved_annotations, int prefetch_distance) {
     PipelineRewriter rewriter(buffer_data_to_buffer, double_buffers, pipeline_allocs, pipeline_loop,
-                              pipeline_info, fragment_info, preserved_annotations);
+                              pipeline_info, fragment_info, preserved_annotations,
+                              prefetch_distance);
     return rewriter.BuildPipeline();
   }
 
@@ -328,7 +375,7 @@ class PipelineRewriter : public StmtExprMutator {
                    const Array<Buffer>& pipeline_allocs, const For& pipeline_loop,
                    const PipelineInfo& pipeline_info,
                    const std::unordered_map<const VarNode*, FragmentInfo>& fragment_info,
-                   const Map<String, ObjectRef> preserved_annotations)
+                   const Map<String, ObjectRef> preserved_annotations, int prefetch_distance)
 
       : buffer_data_to_buffer_(std::move(buffer_data_to_buffer)),
         double_buffers_(double_buffers),
@@ -336,7 +383,8 @@ class PipelineRewriter : public StmtExprMutator {
         pipeline_loop_(pipeline_loop),
         pipeline_info_(pipeline_info),
         fragment_info_(fragment_info),
-        preserved_annotations_(preserved_annotations) {}
+        preserved_annotations_(preserved_annotations),
+        prefetch_distance_(prefetch_distance) {}
 
   Stmt BuildPipeline() {
     // Step 1: Analyze accesses to the buffers in the pipeline and compute the number of versions
@@ -820,6 +868,8 @@ class PipelineRewriter : public StmtExprMutator {
     }
 
     std::vector<RewrittenBlockInfo> new_blocks;
+    // Prefetches of the inputs of producer stages, issued ahead of the steady-state iterations.
+    Array<Stmt> prefetches;
 
     // Async related
     std::map<int, AsyncStateLocal> async_states_local;
@@ -853,6 +903,26 @@ class PipelineRewriter : public StmtExprMutator {
       new_block = Downcast<Block>(
           Substitute(new_block, {{pipeline_loop_->loop_var, normalized_access_index}}));
 
+      if (prefetch_distance_ > 0 && !unroll_loop && stage < max_stage_) {
+        PrimExpr ahead = min(normalized_access_index + prefetch_distance_,
+                             pipeline_loop_->min + pipeline_loop_->extent - 1);
+        for (const BufferRegion& read : block->reads) {
+          if (std::any_of(pipeline_allocs_.begin(), pipeline_allocs_.end(),
+                          [&](const Buffer& alloc) { return alloc.same_as(read->buffer); })) {
+            continue;
+          }
+          BufferRegion region = read;
+          region.CopyOnWrite()->region = read->region.Map([&](const Range& range) {
+            return Range::FromMinExtent(
+                analyzer_.Simplify(Substitute(range->min, {{pipeline_loop_->loop_var, ahead}})),
+                analyzer_.Simplify(range->extent));
+          });
+          if (Optional<Stmt> prefetch = MakeRegionPrefetch(region)) {
+            prefetches.push_back(prefetch.value());
+          }
+        }
+      }
+
       if (pipeline_info_[block].async) {
         auto& local_state = async_states_local[stage];
 
@@ -907,6 +977,10 @@ class PipelineRewriter : public StmtExprMutator {
 
     PopulateWaitCounts(new_blocks, &ana_normalized, buffer_to_commit_group, &async_states_local);
     auto stmts = CompletePipelineLoopStatements(new_blocks, async_states_local, &ana_normalized);
+    if (!prefetches.empty()) {
+      prefetches.insert(prefetches.end(), stmts.begin(), stmts.end());
+      stmts = std::move(prefetches);
+    }
 
     Stmt new_loop{nullptr};
 
@@ -957,6 +1031,7 @@ class PipelineRewriter : public StmtExprMutator {
   Array<Block> ordered_stmts_;
   std::map<int, AsyncStateGlobal> async_states;
   Map<String, ObjectRef> preserved_annotations_;
+  int prefetch_distance_;
 };
 
 /*!
@@ -1131,11 +1206,17 @@ class PipelineInjector : private StmtExprMutator {
     for (const auto& kv : op->annotations) {
       const String& key = kv.first;
       if (kv.first != attr::software_pipeline_stage && kv.first != attr::software_pipeline_order &&
-          kv.first != attr::software_pipeline_async_stages) {
+          kv.first != attr::software_pipeline_async_stages &&
+          kv.first != attr::software_pipeline_prefetch) {
         preserved_annotations.Set(key, kv.second);
       }
     }
 
+    int prefetch_distance = 0;
+    if (auto annot = op->annotations.Get(attr::software_pipeline_prefetch)) {
+      prefetch_distance = Downcast<Integer>(annot)->value;
+    }
+
     for (size_t i = 0; i < pipeline_stages.size(); i++) {
       int stage = static_cast<int>(pipeline_stages[i]->value);
       bool is_async = pipeline_async_stages.find(stage) != pipeline_async_stages.end();
@@ -1150,7 +1231,8 @@ class PipelineInjector : private StmtExprMutator {
     // Step 4: Rewrite the pipeline body.
     Stmt pipeline = PipelineRewriter::Rewrite(buffer_data_to_buffer_, double_buffers,
                                               pipeline_allocs, GetRef<For>(op), pipeline_info,
-                                              fragment_info_, preserved_annotations);
+                                              fragment_info_, preserved_annotations,
+                                              prefetch_distance);
 
     if (const auto* realize = op->body.as<BlockRealizeNode>()) {
       const auto& block = realize->block;
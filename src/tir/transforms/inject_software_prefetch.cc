@@ -0,0 +1,307 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file inject_software_prefetch.cc
+ * \brief Insert software prefetches for strided and indirect loads on CPU.
+ */
+#include <tvm/arith/analyzer.h>
+#include <tvm/arith/pattern.h>
+#include <tvm/runtime/registry.h>
+#include <tvm/target/target.h>
+#include <tvm/tir/analysis.h>
+#include <tvm/tir/builtin.h>
+#include <tvm/tir/op.h>
+#include <tvm/tir/stmt_functor.h>
+#include <tvm/tir/transform.h>
+
+#include <cstdlib>
+#include <functional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "ir_utils.h"
+
+namespace tvm {
+namespace tir {
+
+struct InjectSoftwarePrefetchConfigNode
+    : public tvm::AttrsNode<InjectSoftwarePrefetchConfigNode> {
+  int distance;
+  int cache_line_bytes;
+
+  TVM_DECLARE_ATTRS(InjectSoftwarePrefetchConfigNode,
+                    "tir.transform.InjectSoftwarePrefetchConfig") {
+    TVM_ATTR_FIELD(distance)
+        .describe("The number of iterations to prefetch ahead. 0 disables the pass.")
+        .set_default(0);
+    TVM_ATTR_FIELD(cache_line_bytes)
+        .describe("Loads with a smaller stride in bytes are left to the hardware prefetcher.")
+        .set_default(64);
+  }
+};
+
+class InjectSoftwarePrefetchConfig : public Attrs {
+ public:
+  TVM_DEFINE_NOTNULLABLE_OBJECT_REF_METHODS(InjectSoftwarePrefetchConfig, Attrs,
+                                            InjectSoftwarePrefetchConfigNode);
+};
+
+TVM_REGISTER_NODE_TYPE(InjectSoftwarePrefetchConfigNode);
+TVM_REGISTER_PASS_CONFIG_OPTION("tir.InjectSoftwarePrefetch", InjectSoftwarePrefetchConfig);
+
+/*!
+ * \brief Collect the loads of a loop body that are executed unconditionally,
+ *  the variables defined inside the body, and the loops nested in it.
+ */
+class PrefetchCandidateCollector : public StmtExprVisitor {
+ public:
+  std::vector<BufferLoad> loads;
+  std::unordered_set<const VarNode*> local_vars;
+  /*! \brief The variables and the starts of the nested loops, outer ones first. */
+  std::vector<std::pair<Var, PrimExpr>> loops;
+
+ private:
+  void VisitStmt_(const IfThenElseNode* op) final { VisitExpr(op->condition); }
+
+  void VisitStmt_(const ForNode* op) final {
+    loops.emplace_back(op->loop_var, op->min);
+    StmtExprVisitor::VisitStmt_(op);
+  }
+
+  void VisitStmt_(const LetStmtNode* op) final {
+    local_vars.insert(op->var.get());
+    StmtExprVisitor::VisitStmt_(op);
+  }
+
+  void VisitStmt_(const AllocateNode* op) final {
+    local_vars.insert(op->buffer_var.get());
+    StmtExprVisitor::VisitStmt_(op);
+  }
+
+  void VisitExpr_(const LetNode* op) final {
+    local_vars.insert(op->var.get());
+    StmtExprVisitor::VisitExpr_(op);
+  }
+
+  void VisitExpr_(const CallNode* op) final {
+    if (op->op.same_as(builtin::if_then_else())) {
+      VisitExpr(op->args[0]);
+    } else if (!op->op.same_as(builtin::address_of())) {
+      StmtExprVisitor::VisitExpr_(op);
+    }
+  }
+
+  void VisitExpr_(const BufferLoadNode* op) final {
+    loads.push_back(GetRef<BufferLoad>(op));
+    StmtExprVisitor::VisitExpr_(op);
+  }
+};
+
+/*!
+ * \brief Prefetch the loads of innermost loops that the hardware prefetcher
+ *  handles poorly: the ones with a stride of at least one cache line, and the
+ *  indirect ones whose index is itself loaded from memory (e.g. embedding
+ *  gathers and sparse operators).
+ *
+ *  for (i, 0, n) {
+ *    C[i] = A[B[i]]
+ *  }
+ *  ->
+ *  for (i, 0, n) {
+ *    prefetch(&A[B[min(i + distance, n - 1)]])
+ *    C[i] = A[B[i]]
+ *  }
+ *
+ *  The prefetched iteration is clamped to the loop range, so that the index
+ *  loads of indirect accesses stay in bounds.
+ *
+ *  An indirect access whose index is loaded in an outer loop, such as the row
+ *  gather A[B[i], j], is prefetched in that loop instead, at the start of the
+ *  row that the inner loops walk through sequentially:
+ *
+ *  for (i, 0, n) {
+ *    prefetch(&A[B[min(i + distance, n - 1)] * m])
+ *    for (j, 0, m) {
+ *      C[i * m + j] = A[B[i] * m + j]
+ *    }
+ *  }
+ */
+class SoftwarePrefetchInjector : public StmtExprMutator {
+ public:
+  SoftwarePrefetchInjector(int distance, int cache_line_bytes)
+      : distance_(distance), cache_line_bytes_(cache_line_bytes) {}
+
+  Stmt VisitStmt_(const AttrStmtNode* op) final {
+    if (op->attr_key == attr::pragma_software_prefetch) {
+      const auto* distance = op->value.as<IntImmNode>();
+      ICHECK(distance) << "ValueError: " << attr::pragma_software_prefetch
+                       << " requires a constant distance, but gets " << op->value;
+      int outer_distance = distance_;
+      distance_ = static_cast<int>(distance->value);
+      Stmt body = VisitStmt(op->body);
+      distance_ = outer_distance;
+      return body;
+    }
+    return StmtExprMutator::VisitStmt_(op);
+  }
+
+  Stmt VisitStmt_(const ForNode* op) final {
+    has_loop_ = false;
+    Stmt stmt = StmtExprMutator::VisitStmt_(op);
+    bool is_innermost = !has_loop_;
+    has_loop_ = true;
+    if (distance_ <= 0 || op->kind == ForKind::kThreadBinding) {
+      return stmt;
+    }
+    op = stmt.as<ForNode>();
+    Array<Stmt> prefetches = MakePrefetches(op, is_innermost);
+    if (prefetches.empty()) {
+      return stmt;
+    }
+    prefetches.push_back(op->body);
+    For new_loop = GetRef<For>(op);
+    new_loop.CopyOnWrite()->body = SeqStmt::Flatten(prefetches);
+    return std::move(new_loop);
+  }
+
+ private:
+  /*! \brief Whether the expression contains a load whose index uses a variable in `vars`. */
+  static bool HasIndirection(const PrimExpr& index,
+                             const std::function<bool(const VarNode*)>& vars) {
+    bool found = false;
+    PostOrderVisit(index, [&](const ObjectRef& node) {
+      if (const auto* load = node.as<BufferLoadNode>()) {
+        for (const PrimExpr& e : load->indices) {
+          found = found || UsesVar(e, vars);
+        }
+      }
+    });
+    return found;
+  }
+
+  /*!
+   * \brief Make the prefetches of a loop. An innermost loop prefetches its strided and
+   *  indirect loads, an outer loop the indirect loads whose indices are loaded at its level.
+   */
+  Array<Stmt> MakePrefetches(const ForNode* loop, bool is_innermost) {
+    PrefetchCandidateCollector collector;
+    collector(loop->body);
+    const Var& loop_var = loop->loop_var;
+    auto is_loop_var = [&](const VarNode* v) { return v == loop_var.get(); };
+    std::unordered_set<const VarNode*> inner_loop_vars;
+    for (const auto& inner_loop : collector.loops) {
+      inner_loop_vars.insert(inner_loop.first.get());
+    }
+    auto is_inner_loop_var = [&](const VarNode* v) { return inner_loop_vars.count(v) != 0; };
+    PrimExpr last = analyzer_.Simplify(loop->min + loop->extent - 1);
+    PrimExpr ahead = min(loop_var + make_const(loop_var.dtype(), distance_), last);
+
+    Array<Stmt> prefetches;
+    std::vector<PrimExpr> seen;
+    for (const BufferLoad& load : collector.loads) {
+      // Only flat buffers are handled, which is the case after FlattenBuffer.
+      if (load->indices.size() != 1 || load->buffer.scope() != "global") {
+        continue;
+      }
+      PrimExpr index = load->indices[0];
+      if (const auto* ramp = index.as<RampNode>()) {
+        index = ramp->base;
+      }
+      if (!is_innermost) {
+        // The inner loops start at their first iterations, the ones with indirections through
+        // the inner loops are left to them.
+        if (!HasIndirection(index, is_loop_var) || HasIndirection(index, is_inner_loop_var)) {
+          continue;
+        }
+        for (auto it = collector.loops.rbegin(); it != collector.loops.rend(); ++it) {
+          index = Substitute(index, {{it->first, it->second}});
+        }
+        index = analyzer_.Simplify(index);
+        if (UsesVar(index, is_inner_loop_var)) {
+          continue;
+        }
+      }
+      if (!UsesVar(index, is_loop_var) ||
+          UsesVar(index, [&](const VarNode* v) { return collector.local_vars.count(v); })) {
+        continue;
+      }
+      if (!HasIndirection(index, is_loop_var)) {
+        Array<PrimExpr> coeff = arith::DetectLinearEquation(index, {loop_var});
+        if (coeff.empty()) {
+          continue;
+        }
+        const auto* stride = coeff[0].as<IntImmNode>();
+        if (!stride || std::abs(stride->value) * load->buffer->dtype.bytes() < cache_line_bytes_) {
+          continue;
+        }
+      }
+      PrimExpr target = Substitute(index, {{loop_var, ahead}});
+      bool duplicate = false;
+      for (const PrimExpr& prev : seen) {
+        duplicate = duplicate || ExprDeepEqual()(prev, target);
+      }
+      if (duplicate) {
+        continue;
+      }
+      seen.push_back(target);
+      PrimExpr addr = Call(DataType::Handle(), builtin::address_of(),
+                           {BufferLoad(load->buffer, {target})});
+      prefetches.push_back(
+          Evaluate(Call(load->buffer->dtype, builtin::prefetch(), {addr, 0, 3, 1})));
+    }
+    return prefetches;
+  }
+
+  /*! \brief The number of iterations to prefetch ahead. */
+  int distance_;
+  /*! \brief The size of a cache line in bytes. */
+  int cache_line_bytes_;
+  /*! \brief Whether the visited statement contains a loop. */
+  bool has_loop_{false};
+  arith::Analyzer analyzer_;
+};
+
+namespace transform {
+
+Pass InjectSoftwarePrefetch() {
+  auto pass_func = [=](PrimFunc f, IRModule m, PassContext ctx) {
+    if (Optional<Target> target = f->GetAttr<Target>(tvm::attr::kTarget)) {
+      if (target.value()->GetTargetDeviceType() != kDLCPU) {
+        return f;
+      }
+    }
+    auto cfg = ctx->GetConfig<InjectSoftwarePrefetchConfig>("tir.InjectSoftwarePrefetch");
+    if (!cfg.defined()) {
+      cfg = AttrsWithDefaultValues<InjectSoftwarePrefetchConfig>();
+    }
+    auto* n = f.CopyOnWrite();
+    n->body = SoftwarePrefetchInjector(cfg.value()->distance,
+                                       cfg.value()->cache_line_bytes)(std::move(n->body));
+    return f;
+  };
+  return CreatePrimFuncPass(pass_func, 0, "tir.InjectSoftwarePrefetch", {});
+}
+
+TVM_REGISTER_GLOBAL("tir.transform.InjectSoftwarePrefetch").set_body_typed(InjectSoftwarePrefetch);
+
+}  // namespace transform
+}  // namespace tir
+}  // namespace tvm
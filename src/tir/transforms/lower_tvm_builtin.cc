@@ -291,6 +291,10 @@ class BuiltinLower : public StmtExprMutator {
       ICHECK(!device_type_);
       device_type_ = op->value;
       return this->VisitStmt(op->body);
+    } else if (op->attr_key == attr::parallel_dispatch) {
+      // dispatched tasks run concurrently, so each needs its own stack frame
+      Stmt body = this->VisitBodyAndRealizeAlloca(op->body);
+      return AttrStmt(op->node, op->attr_key, op->value, body);
     } else {
       return StmtExprMutator::VisitStmt_(op);
     }
@@ -23,6 +23,7 @@
 // Loop vectorizer as in Halide pipeline.
 #include <tvm/arith/analyzer.h>
 #include <tvm/runtime/registry.h>
+#include <tvm/target/target.h>
 #include <tvm/tir/analysis.h>
 #include <tvm/tir/builtin.h>
 #include <tvm/tir/expr.h>
@@ -141,6 +142,57 @@ class VecAllocAccess : public StmtExprMutator {
   arith::Analyzer analyzer_;
 };
 
+// Whether a vectorized buffer access touches `lanes` consecutive elements.
+bool IsContiguousAccess(const Buffer& buffer, const Array<PrimExpr>& indices, int lanes) {
+  if (buffer->dtype.lanes() != 1) return false;
+  for (size_t i = 0; i + 1 < indices.size(); ++i) {
+    if (indices[i].dtype().is_vector()) return false;
+  }
+  const RampNode* ramp = indices.back().as<RampNode>();
+  return ramp && ramp->lanes == lanes && is_one(ramp->stride);
+}
+
+// Replace the vector loads of a vectorized expression by masked loads, so
+// that lanes disabled by the mask never touch memory.  Fails on anything else
+// that is unsafe to evaluate in a disabled lane: a load that cannot be masked,
+// including a scalar load that is guarded by the same condition, and an integer
+// division, which may trap on the garbage of a disabled lane.
+class LoadMasker : public ExprMutator {
+ public:
+  LoadMasker(PrimExpr mask, int lanes) : mask_(mask), lanes_(lanes) {}
+
+  bool success() const { return success_; }
+
+  PrimExpr VisitExpr_(const BufferLoadNode* op) final {
+    if (!IsContiguousAccess(op->buffer, op->indices, lanes_)) {
+      success_ = false;
+      return GetRef<PrimExpr>(op);
+    }
+    PrimExpr addr = Call(DataType::Handle(), builtin::address_of(), {GetRef<BufferLoad>(op)});
+    return Call(op->dtype, builtin::masked_load(), {addr, mask_});
+  }
+
+  PrimExpr VisitExpr_(const DivNode* op) final { return CheckDivision(op); }
+  PrimExpr VisitExpr_(const ModNode* op) final { return CheckDivision(op); }
+  PrimExpr VisitExpr_(const FloorDivNode* op) final { return CheckDivision(op); }
+  PrimExpr VisitExpr_(const FloorModNode* op) final { return CheckDivision(op); }
+
+ private:
+  template <typename T>
+  PrimExpr CheckDivision(const T* op) {
+    if (op->dtype.is_int() || op->dtype.is_uint()) {
+      success_ = false;
+      return GetRef<PrimExpr>(op);
+    }
+    return ExprMutator::VisitExpr_(op);
+  }
+
+ private:
+  PrimExpr mask_;
+  int lanes_;
+  bool success_{true};
+};
+
 // We use ExprFunctor directly instead of StmtExprMutator
 // This is because the transformation can change the dtype of the Expr
 // The existing ExprMutator transformation rules may not be well defined.
@@ -149,7 +201,8 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
   using ExprFunctor::VisitExpr;
   using StmtMutator::operator();
 
-  Vectorizer(Var var, int var_lanes) : var_(var), var_lanes_(var_lanes) {
+  Vectorizer(Var var, int var_lanes, bool masked_tail = false)
+      : var_(var), var_lanes_(var_lanes), masked_tail_(masked_tail) {
     ramp_ = Ramp(IntImm(var->dtype, 0), IntImm(var->dtype, 1), var_lanes);
   }
 
@@ -467,6 +520,11 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
     ICHECK(!op->condition.dtype().is_vector());
     PrimExpr condition = this->VisitExpr(op->condition);
     if (condition.dtype().is_vector()) {
+      if (masked_tail_ && !op->else_case.defined()) {
+        if (Optional<Stmt> masked = MaskStores(condition, op->then_case)) {
+          return masked.value();
+        }
+      }
       return Scalarize(GetRef<Stmt>(op));
     }
     Stmt then_case = this->VisitStmt(op->then_case);
@@ -553,6 +611,47 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
     LOG(FATAL) << "ProducerProvide cannot appear in a TIR PrimFunc";
   }
 
+  /*!
+   * \brief Vectorize the body of an if statement whose condition depends on
+   *  the vectorized variable into masked loads and stores.
+   *
+   *  This is the case for the tail of a loop split by a factor that does not
+   *  divide its extent.  Only contiguous stores whose values are safe to
+   *  compute in every lane (see LoadMasker) can be masked; in any other case
+   *  NullOpt is returned and the caller scalarizes.
+   */
+  Optional<Stmt> MaskStores(PrimExpr mask, const Stmt& body) {
+    if (const CallNode* call = mask.as<CallNode>()) {
+      if (call->op.same_as(builtin::likely())) {
+        mask = call->args[0];
+      }
+    }
+    if (mask.dtype().lanes() != var_lanes_) return NullOpt;
+
+    Array<Stmt> stores;
+    if (const SeqStmtNode* seq = body.as<SeqStmtNode>()) {
+      stores = seq->seq;
+    } else {
+      stores.push_back(body);
+    }
+    std::vector<Stmt> masked;
+    for (const Stmt& stmt : stores) {
+      if (!stmt->IsInstance<BufferStoreNode>()) return NullOpt;
+      Stmt vectorized = this->VisitStmt(stmt);
+      if (!vectorized->IsInstance<BufferStoreNode>()) return NullOpt;
+      BufferStore store = Downcast<BufferStore>(vectorized);
+      if (!IsContiguousAccess(store->buffer, store->indices, var_lanes_)) return NullOpt;
+      LoadMasker masker(mask, var_lanes_);
+      PrimExpr value = masker(store->value);
+      if (!masker.success() || value.dtype().lanes() != var_lanes_) return NullOpt;
+      PrimExpr addr = Call(DataType::Handle(), builtin::address_of(),
+                           {BufferLoad(store->buffer, store->indices)});
+      masked.push_back(
+          Evaluate(Call(DataType::Handle(), builtin::masked_store(), {addr, value, mask})));
+    }
+    return SeqStmt::Flatten(masked);
+  }
+
  private:
   // analyzer
   arith::Analyzer analyzer_;
@@ -564,6 +663,8 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
   int var_lanes_;
   // ramp representing the var.
   PrimExpr ramp_;
+  // whether to vectorize conditional stores with masks instead of scalarizing.
+  bool masked_tail_;
   // flag to mark requirment of scalarization.
   bool need_scalarize_{false};
   // Let binding
@@ -633,6 +734,8 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
 
 class LoopVectorizer : public StmtMutator {
  public:
+  explicit LoopVectorizer(bool masked_tail = false) : masked_tail_(masked_tail) {}
+
   Stmt VisitStmt_(const ForNode* op) final {
     if (op->kind == ForKind::kVectorized) {
       ICHECK(is_zero(op->min));
@@ -640,11 +743,15 @@ class LoopVectorizer : public StmtMutator {
       if (!extent_as_int || extent_as_int->value < 1) {
         LOG(FATAL) << "Failed to vectorize loop with extent " << op->extent;
       }
-      return Vectorizer(op->loop_var, static_cast<int>(extent_as_int->value))(op->body);
+      return Vectorizer(op->loop_var, static_cast<int>(extent_as_int->value),
+                        masked_tail_)(op->body);
     } else {
       return StmtMutator::VisitStmt_(op);
     }
   }
+
+ private:
+  bool masked_tail_;
 };
 
 Stmt VectorizeLoop(Stmt stmt) { return LoopVectorizer()(std::move(stmt)); }
@@ -666,12 +773,19 @@ Stmt SkipVectorize(Stmt stmt) { return VectorizeSkipper()(std::move(stmt)); }
 
 namespace transform {
 
+TVM_REGISTER_PASS_CONFIG_OPTION("tir.vectorize_masked_tail", Bool);
+
 // TODO(tvm-team): Make it as a target property.
 Pass VectorizeLoop(bool enable_vectorize) {
   auto pass_func = [=](PrimFunc f, IRModule m, PassContext ctx) {
+    // Masked loads and stores are only lowered by the LLVM backend.
+    bool masked_tail = ctx->GetConfig<Bool>("tir.vectorize_masked_tail", Bool(false)).value();
+    if (Optional<Target> target = f->GetAttr<Target>(tvm::attr::kTarget)) {
+      masked_tail = masked_tail && target.value()->kind->name == "llvm";
+    }
     auto* n = f.CopyOnWrite();
     if (enable_vectorize) {
-      n->body = LoopVectorizer()(std::move(n->body));
+      n->body = LoopVectorizer(masked_tail)(std::move(n->body));
     } else {
       n->body = VectorizeSkipper()(std::move(n->body));
     }
@@ -52,7 +52,7 @@ namespace algo {
  * \brief Rounds up the offset to satisfy the alignement requirement
  */
 size_t GreedyBase::round_up_to_byte_alignment(const size_t& non_aligned_byte_offset,
-                                              const int& byte_alignment) {
+                                              const int& byte_alignment) const {
   return ((non_aligned_byte_offset + byte_alignment - 1) / byte_alignment) * byte_alignment;
 }
 
@@ -22,7 +22,9 @@
  * \brief Implement greedy by size memory planning algorithm
  */
 #include <tvm/arith/analyzer.h>
+#include <tvm/ir/transform.h>
 #include <tvm/runtime/device_api.h>
+#include <tvm/support/parallel_for.h>
 #include <tvm/tir/builtin.h>
 #include <tvm/tir/function.h>
 #include <tvm/tir/stmt_functor.h>
@@ -30,8 +32,10 @@
 #include <tvm/tir/usmp/utils.h>
 
 #include <algorithm>
+#include <chrono>
 #include <numeric>
 #include <sstream>
+#include <thread>
 
 namespace tvm {
 namespace tir {
@@ -45,17 +49,58 @@ namespace algo {
  * assessing the result, and introducing permutations to the allocation
  * order which hopefully will led to more 'compact' memory allocation.
  * Do not forget to use srand for repeatable results
+ *
+ * Internally the buffers and pools are addressed by dense indices: each
+ * attempt only touches flat offset/pool vectors and every buffer keeps its
+ * conflicts as indices, so the placement of a buffer is found by walking
+ * the address intervals of its already placed conflicts sorted by offset.
+ * Independent restarts (seeds 0..N-1) may run in parallel and the best plan
+ * is kept; restart 0 reproduces the single-run behaviour.
  */
 class HillClimbAllocator : public GreedyBase {
  private:
   size_t memory_pressure_ = 0;
+  int num_restarts_ = 1;
+  int64_t time_budget_ms_ = 0;
 
  public:
-  explicit HillClimbAllocator(size_t memory_pressure)
-      : GreedyBase(), memory_pressure_(memory_pressure) {}
+  explicit HillClimbAllocator(size_t memory_pressure, int num_restarts = 1,
+                              int64_t time_budget_ms = 0)
+      : GreedyBase(),
+        memory_pressure_(memory_pressure),
+        num_restarts_(std::max(num_restarts, 1)),
+        time_budget_ms_(time_budget_ms) {}
 
  protected:
-  using alloc_map_t = std::unordered_map<const BufferInfoNode*, PoolAllocation>;
+  /*
+   * Placement of every buffer, indexed by buffer id.
+   * A pool id of -1 means the buffer could not be placed.
+   */
+  struct Placement {
+    std::vector<int> pool;
+    std::vector<size_t> offset;
+  };
+
+  /*
+   * Outcome of a single hill climb run
+   */
+  struct ClimbResult {
+    Placement placement;
+    size_t total_size = 0;
+    bool fits = false;
+  };
+
+  // buffers in the initial (sorted) order, the id of a buffer is its index here
+  std::vector<BufferInfo> buffers_;
+  std::vector<size_t> sizes_;
+  std::vector<int> alignments_;
+  // conflicts and pool candidates of each buffer, in their original order
+  std::vector<std::vector<int>> conflicts_;
+  std::vector<std::vector<int>> pool_candidates_;
+  // pools and their size limits
+  std::vector<PoolInfo> pools_;
+  std::vector<bool> pool_bounded_;
+  std::vector<size_t> pool_limits_;
 
   /*
    * Initial sorting routine
@@ -74,97 +119,137 @@ class HillClimbAllocator : public GreedyBase {
     });
   }
 
+  /*
+   * Builds the index based representation of the buffers and the pools
+   * \param buffer_info_vec - buffers in the initial allocation order
+   */
+  void build_index(const std::vector<BufferInfo>& buffer_info_vec) {
+    buffers_ = buffer_info_vec;
+    std::unordered_map<const BufferInfoNode*, int> buf_ids;
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      buf_ids[buffers_[i].as<BufferInfoNode>()] = i;
+    }
+    std::unordered_map<PoolInfo, int, ObjectPtrHash, ObjectPtrEqual> pool_ids;
+    for (const auto& buf_info : buffers_) {
+      sizes_.push_back(buf_info->size_bytes->value);
+      alignments_.push_back(buf_info->alignment->value);
+      std::vector<int> conflicts;
+      for (const auto& conflict : buf_info->conflicts) {
+        auto it = buf_ids.find(conflict.as<BufferInfoNode>());
+        ICHECK(it != buf_ids.end())
+            << "Conflicting buffer of \"" << buf_info->name_hint << "\" is not being planned";
+        conflicts.push_back(it->second);
+      }
+      conflicts_.push_back(std::move(conflicts));
+      std::vector<int> candidates;
+      for (const auto& pool_info : buf_info->pool_candidates) {
+        auto it = pool_ids.find(pool_info);
+        if (it == pool_ids.end()) {
+          it = pool_ids.emplace(pool_info, pools_.size()).first;
+          pools_.push_back(pool_info);
+          // rejects pool kinds that are not supported
+          IsValidPlacement(pool_info, 0, 0);
+          bool bounded = pool_info->size_hint_bytes.IntValue() != kUnrestrictedPoolSizeHint;
+          pool_bounded_.push_back(bounded);
+          pool_limits_.push_back(bounded ? pool_info->size_hint_bytes.IntValue() : 0);
+        }
+        candidates.push_back(it->second);
+      }
+      pool_candidates_.push_back(std::move(candidates));
+    }
+  }
+
+  /*
+   * Index based counterpart of IsValidPlacement
+   */
+  bool is_valid_placement(int pool, size_t offset, size_t size_bytes) const {
+    return !pool_bounded_[pool] || offset + size_bytes <= pool_limits_[pool];
+  }
+
   /*
    * HillClimb's version of greedy allocation
-   * \param buffer_info_vec - buffers in specific order for allocation
+   * \param order - buffer ids in specific order for allocation
+   * \param pos - position of each buffer id in order
    */
-  alloc_map_t greedy(const std::vector<BufferInfo>& buffer_info_vec, bool* could_not_fit) {
-    alloc_map_t pool_allocations(buffer_info_vec.size());
-    for (const auto& buf_info : buffer_info_vec) {
-      std::unordered_map<PoolInfo, size_t, ObjectPtrHash, ObjectPtrEqual> pool_offset_candidates;
+  void greedy(const std::vector<int>& order, const std::vector<int>& pos, Placement* placement,
+              bool* could_not_fit) const {
+    std::vector<size_t> offset_candidates(pools_.size());
+    std::vector<bool> has_candidate(pools_.size());
+    std::vector<int> buf_conf;
+    for (int buf : order) {
+      size_t size = sizes_[buf];
+      std::fill(has_candidate.begin(), has_candidate.end(), false);
 
       // check whether we can fit the buffer into the empty pool candidate
-      for (const auto& pool_info : buf_info->pool_candidates) {
-        if (IsValidPlacement(pool_info, 0, buf_info->size_bytes->value)) {
-          pool_offset_candidates[pool_info] = 0;
+      for (int pool : pool_candidates_[buf]) {
+        if (is_valid_placement(pool, 0, size)) {
+          has_candidate[pool] = true;
+          offset_candidates[pool] = 0;
         }
       }
       // select conflicting buffers which have already been allocated
-      std::vector<const BufferInfoNode*> buf_conf;
-      for (const auto& conflict_buf_info_obj : buf_info->conflicts) {
-        const BufferInfoNode* conflict_buf_info = conflict_buf_info_obj.as<BufferInfoNode>();
-        if (pool_allocations.end() != pool_allocations.find(conflict_buf_info)) {
-          buf_conf.push_back(conflict_buf_info);
+      buf_conf.clear();
+      for (int conflict : conflicts_[buf]) {
+        if (pos[conflict] < pos[buf]) {
+          buf_conf.push_back(conflict);
         }
       }
 
       // extra sorting for pool offsets
-      std::sort(buf_conf.begin(), buf_conf.end(),
-                [&pool_allocations](const auto* a, const auto* b) {
-                  return pool_allocations[a]->byte_offset->value <
-                         pool_allocations[b]->byte_offset->value;
-                });
-
-      for (const auto* conflict_buf_info : buf_conf) {
-        size_t next_offset = 0;
-        auto pool_allocation = pool_allocations[conflict_buf_info];
-        if (!pool_offset_candidates.count(pool_allocation->pool_info)) {
+      std::sort(buf_conf.begin(), buf_conf.end(), [placement](int a, int b) {
+        return placement->offset[a] < placement->offset[b];
+      });
+
+      for (int conflict : buf_conf) {
+        int pool = placement->pool[conflict];
+        if (pool < 0 || !has_candidate[pool]) {
           continue;
         }
-
-        next_offset =
-            pool_allocation->byte_offset.IntValue() + conflict_buf_info->size_bytes.IntValue();
-        next_offset = round_up_to_byte_alignment(next_offset, conflict_buf_info->alignment->value);
-
-        if (IsValidPlacement(pool_allocation->pool_info, next_offset,
-                             buf_info->size_bytes->value)) {
+        size_t conflict_offset = placement->offset[conflict];
+        size_t next_offset = round_up_to_byte_alignment(conflict_offset + sizes_[conflict],
+                                                        alignments_[conflict]);
+        if (is_valid_placement(pool, next_offset, size)) {
           // extra check whether the previous attempt to fit the buffer is clashing with the current
           // conflict
-          if (next_offset > pool_offset_candidates[pool_allocation->pool_info] &&
-              pool_offset_candidates[pool_allocation->pool_info] +
-                      static_cast<size_t>(buf_info->size_bytes.IntValue()) >
-                  static_cast<size_t>(pool_allocation->byte_offset.IntValue())) {
-            pool_offset_candidates[pool_allocation->pool_info] = next_offset;
+          if (next_offset > offset_candidates[pool] &&
+              offset_candidates[pool] + size > conflict_offset) {
+            offset_candidates[pool] = next_offset;
           }
         } else {
-          pool_offset_candidates.erase(pool_allocation->pool_info);
+          has_candidate[pool] = false;
         }
       }
-      auto selected_pool = NullValue<PoolInfo>();
-      for (const auto& pi : buf_info->pool_candidates) {
-        if (pool_offset_candidates.count(pi)) {
-          selected_pool = pi;
+      int selected_pool = -1;
+      for (int pool : pool_candidates_[buf]) {
+        if (has_candidate[pool]) {
+          selected_pool = pool;
           break;
         }
       }
 
-      if (selected_pool.same_as(NullValue<PoolInfo>())) {
+      if (selected_pool < 0) {
         *could_not_fit = true;
       }
-
-      pool_allocations[buf_info.as<BufferInfoNode>()] =
-          PoolAllocation(selected_pool, Integer(pool_offset_candidates[selected_pool]));
+      placement->pool[buf] = selected_pool;
+      placement->offset[buf] = selected_pool < 0 ? 0 : offset_candidates[selected_pool];
     }
-    return pool_allocations;
   }
 
   /*
    * Finds highest allocated memory address for each pool
    */
-  std::unordered_map<PoolInfo, size_t, ObjectPtrHash, ObjectPtrEqual> find_highest(
-      alloc_map_t* pool_allocations) {
-    std::unordered_map<PoolInfo, size_t, ObjectPtrHash, ObjectPtrEqual> pool_sizes;
-    for (const auto& it : *pool_allocations) {
-      const BufferInfoNode* buf = it.first;
-      const PoolAllocation& pa = it.second;
-      if (pa->pool_info.same_as(NullValue<PoolInfo>())) {
+  std::vector<size_t> find_highest(const Placement& placement) const {
+    std::vector<size_t> pool_sizes(pools_.size(), 0);
+    bool any_placed = false;
+    for (size_t buf = 0; buf < buffers_.size(); ++buf) {
+      int pool = placement.pool[buf];
+      if (pool < 0) {
         continue;
       }
-      size_t high_sz = pa->byte_offset.IntValue() + buf->size_bytes.IntValue();
-      if (pool_sizes[pa->pool_info] <= high_sz) {
-        pool_sizes[pa->pool_info] = high_sz;
-      }
+      any_placed = true;
+      pool_sizes[pool] = std::max(pool_sizes[pool], placement.offset[buf] + sizes_[buf]);
     }
+    CHECK(any_placed) << "TVM USMP Error: Please increase the size_hints for memory pools.";
     return pool_sizes;
   }
 
@@ -173,53 +258,40 @@ class HillClimbAllocator : public GreedyBase {
    * First level are the immediate neighbors of the buf and
    * second level are the immediate neighbors of the first level nodes
    */
-  template <typename TPos>
-  void collect_neighbor_lists(const BufferInfoNode* buf,
-                              std::vector<const BufferInfoNode*>* first_level,
-                              std::vector<const BufferInfoNode*>* second_level, const TPos& _pos) {
-    auto buf_pos = _pos(buf);
-    for (const auto& c1 : buf->conflicts) {
-      const auto* c1_buf = c1.as<BufferInfoNode>();
-      int c1_pos = _pos(c1_buf);
+  void collect_neighbor_lists(int buf, const std::vector<int>& pos, std::vector<int>* first_level,
+                              std::vector<int>* second_level) const {
+    int buf_pos = pos[buf];
+    for (int c1 : conflicts_[buf]) {
+      int c1_pos = pos[c1];
       if (buf_pos > c1_pos) {
-        first_level->push_back(c1_buf);
+        first_level->push_back(c1);
       }
-      int c2_pos = -1;
-      for (const auto& c2 : c1_buf->conflicts) {
-        const auto c2_buf = c2.as<BufferInfoNode>();
-        if (c1_pos > (c2_pos = _pos(c2_buf))) {
-          second_level->push_back(c2_buf);
+      for (int c2 : conflicts_[c1]) {
+        if (c1_pos > pos[c2]) {
+          second_level->push_back(c2);
         }
       }
     }
   }
 
- public:
-  Map<BufferInfo, PoolAllocation> PlanMemory(const Array<BufferInfo>& buffer_info_arr) {
+  /*
+   * A single hill climb run
+   * \param seed - seed of the random generator of this run
+   * \param deadline - point in time after which no new attempts are started
+   */
+  ClimbResult climb(unsigned int seed, std::chrono::steady_clock::time_point deadline) const {
 // rand_r does not exist on Windows platform
 #if defined(__linux__) || defined(__ANDROID__)
-    unsigned int _seedp = 0;
+    unsigned int _seedp = seed;
 #define rnd_func() rand_r(&_seedp)
 #else
+    (void)seed;
 #define rnd_func() rand()
 #endif
-    Map<BufferInfo, PoolAllocation> result;
-    if (!buffer_info_arr.size()) {
-      return result;
-    }
-    std::vector<BufferInfo> buffer_info_vec;
-    for (const auto& buffer_info : buffer_info_arr) {
-      ICHECK(buffer_info->pool_candidates.size())
-          << "Cannot process buffer \"" << buffer_info->name_hint << "\" with no pool candidates";
-      buffer_info_vec.push_back(std::move(buffer_info));
-    }
-    sort_vector<BufferInfo>(&buffer_info_vec);
-
-    // populate positional index map
-    std::unordered_map<const BufferInfoNode*, int> _pos_map;
-    for (size_t index = 0; index < buffer_info_vec.size(); ++index) {
-      _pos_map[buffer_info_vec[index].as<BufferInfoNode>()] = index;
-    }
+    const int num_buffers = buffers_.size();
+    std::vector<int> order(num_buffers);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<int> pos = order;
 
     size_t total_size = 0;
     int attempts = 0;
@@ -228,53 +300,43 @@ class HillClimbAllocator : public GreedyBase {
     int swap_i2 = -1;
     size_t desired_bytes_ = memory_pressure_;
     constexpr auto _max_attempts = 500;
-    alloc_map_t rollback_pool_allocations;
-    alloc_map_t result_pool_allocations;
-    alloc_map_t pool_allocations;
+    Placement rollback_placement;
+    Placement result_placement;
+    Placement placement;
+    bool result_fits = false;
 
-    auto swap_buffers = [&buffer_info_vec, &_pos_map](int i1, int i2) {
+    auto swap_buffers = [&order, &pos](int i1, int i2) {
       if (i1 == i2) return;
-      auto b1 = buffer_info_vec[i1];
-      auto b2 = buffer_info_vec[i2];
-      buffer_info_vec[i1] = b2;
-      buffer_info_vec[i2] = b1;
-
-      _pos_map[b1.as<BufferInfoNode>()] = i2;
-      _pos_map[b2.as<BufferInfoNode>()] = i1;
-    };
-
-    auto _pos = [&_pos_map](const auto* e) {
-      auto it = _pos_map.find(e);
-      if (it != _pos_map.end()) {
-        return it->second;
-      }
-      LOG(FATAL) << "node is not indexed in the _pos_map";
+      std::swap(order[i1], order[i2]);
+      pos[order[i1]] = i1;
+      pos[order[i2]] = i2;
     };
+    auto by_pos = [&pos](int a, int b) { return pos[a] < pos[b]; };
 
     for (; attempts < _max_attempts; ++attempts) {
-      rollback_pool_allocations = std::move(pool_allocations);
+      // keep the best result so far once the time budget is exhausted
+      if (time_budget_ms_ > 0 && attempts > 0 && std::chrono::steady_clock::now() >= deadline) {
+        break;
+      }
+      rollback_placement = std::move(placement);
+      placement.pool.assign(num_buffers, -1);
+      placement.offset.assign(num_buffers, 0);
       bool could_not_fit = false;
-      pool_allocations = std::move(greedy(buffer_info_vec, &could_not_fit));
+      greedy(order, pos, &placement, &could_not_fit);
 
       // estimate result buffers
-      std::unordered_map<PoolInfo, size_t, ObjectPtrHash, ObjectPtrEqual> pool_sizes =
-          find_highest(&pool_allocations);
-      if (!pool_sizes.size()) {
-        CHECK(false) << "TVM USMP Error: Please increase the size_hints for memory pools.";
-      }
+      std::vector<size_t> pool_sizes = find_highest(placement);
 
       // calculate summary
-      size_t total = 0;
-      for (const auto& el : pool_sizes) {
-        total += el.second;
-      }
+      size_t total = std::accumulate(pool_sizes.begin(), pool_sizes.end(), size_t(0));
       // accept/reject result heuristic
       if (!total_size || /* first run */
           (!could_not_fit &&
            (total_size > total || /* always accept if better or with some probability */
             rnd_func() % 100 < static_cast<int>(50 * (total - total_size) / total / attempts)))) {
         // remember winning combination
-        result_pool_allocations = pool_allocations;
+        result_placement = placement;
+        result_fits = !could_not_fit;
         if (!could_not_fit) {
           total_size = total;
           // reached desired size
@@ -286,37 +348,28 @@ class HillClimbAllocator : public GreedyBase {
       } else {
         // rollback
         swap_buffers(swap_i2, swap_i1);
-        pool_allocations = std::move(rollback_pool_allocations);
-        pool_sizes = find_highest(&pool_allocations);
+        placement = std::move(rollback_placement);
+        pool_sizes = find_highest(placement);
       }
 
-      std::vector<const BufferInfoNode*> max_pool_buf;
-
-      for (const auto& it : pool_allocations) {
-        const auto* buf = it.first;
-        const auto pa = it.second;
-        if (pa->pool_info.same_as(NullValue<PoolInfo>())) {
-          continue;
-        }
-        size_t high_sz = pa->byte_offset.IntValue() + buf->size_bytes.IntValue();
-        if (pool_sizes[pa->pool_info] == high_sz) {
+      std::vector<int> max_pool_buf;
+      for (int buf = 0; buf < num_buffers; ++buf) {
+        int pool = placement.pool[buf];
+        if (pool >= 0 && pool_sizes[pool] == placement.offset[buf] + sizes_[buf]) {
           max_pool_buf.push_back(buf);
         }
       }
       if (!max_pool_buf.size()) {
         CHECK(false) << "TVM USMP Error: Please increase the size_hints for memory pools.";
       }
-      sort(max_pool_buf.begin(), max_pool_buf.end(),
-           [&_pos](const auto* a, const auto* b) { return _pos(a) < _pos(b); });
+      sort(max_pool_buf.begin(), max_pool_buf.end(), by_pos);
       // pick highest
-      const BufferInfoNode* node = max_pool_buf[rnd_func() % max_pool_buf.size()];
-      std::vector<const BufferInfoNode*> first_level;
-      std::vector<const BufferInfoNode*> second_level;
-      collect_neighbor_lists(node, &first_level, &second_level, _pos);
-      sort(first_level.begin(), first_level.end(),
-           [&_pos](const auto* a, const auto* b) { return _pos(a) < _pos(b); });
-      sort(second_level.begin(), second_level.end(),
-           [&_pos](const auto* a, const auto* b) { return _pos(a) < _pos(b); });
+      int node = max_pool_buf[rnd_func() % max_pool_buf.size()];
+      std::vector<int> first_level;
+      std::vector<int> second_level;
+      collect_neighbor_lists(node, pos, &first_level, &second_level);
+      sort(first_level.begin(), first_level.end(), by_pos);
+      sort(second_level.begin(), second_level.end(), by_pos);
 
       // retry if no first level neightbors were collected
       if (!first_level.size()) {
@@ -324,8 +377,8 @@ class HillClimbAllocator : public GreedyBase {
       }
 
       // pick the buffers
-      const BufferInfoNode* swap_buf1 = first_level[rnd_func() % first_level.size()];
-      const BufferInfoNode* swap_buf2 = swap_buf1;
+      int swap_buf1 = first_level[rnd_func() % first_level.size()];
+      int swap_buf2 = swap_buf1;
       while (swap_buf2 == swap_buf1) {
         swap_buf2 = second_level.size() && (!first_level.size() || (rnd_func() % 100 > 25))
                         ? second_level[rnd_func() % second_level.size()]
@@ -337,23 +390,79 @@ class HillClimbAllocator : public GreedyBase {
         continue;
       }
 
-      swap_i1 = _pos(swap_buf1);
-      swap_i2 = _pos(swap_buf2);
+      swap_i1 = pos[swap_buf1];
+      swap_i2 = pos[swap_buf2];
       // do swap
       swap_buffers(swap_i1, swap_i2);
     }
+#undef rnd_func
+
+    ClimbResult result;
+    std::vector<size_t> pool_sizes = find_highest(result_placement);
+    result.total_size = std::accumulate(pool_sizes.begin(), pool_sizes.end(), size_t(0));
+    result.fits = result_fits;
+    result.placement = std::move(result_placement);
+    return result;
+  }
+
+ public:
+  Map<BufferInfo, PoolAllocation> PlanMemory(const Array<BufferInfo>& buffer_info_arr) {
+    Map<BufferInfo, PoolAllocation> result;
+    if (!buffer_info_arr.size()) {
+      return result;
+    }
+    std::vector<BufferInfo> buffer_info_vec;
+    for (const auto& buffer_info : buffer_info_arr) {
+      ICHECK(buffer_info->pool_candidates.size())
+          << "Cannot process buffer \"" << buffer_info->name_hint << "\" with no pool candidates";
+      buffer_info_vec.push_back(std::move(buffer_info));
+    }
+    sort_vector<BufferInfo>(&buffer_info_vec);
+    build_index(buffer_info_vec);
+
+    auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(time_budget_ms_);
+    std::vector<ClimbResult> climbs(num_restarts_);
+    auto run_climb = [this, &climbs, deadline](int restart) {
+      climbs[restart] = climb(restart, deadline);
+    };
+// rand() is not thread safe, so restarts only run in parallel where rand_r is used
+#if defined(__linux__) || defined(__ANDROID__)
+    if (num_restarts_ > 1) {
+      // parallel_for cannot run inside another parallel_for, which the planner may be called from
+      int num_threads = std::max(
+          1, std::min<int>(num_restarts_, static_cast<int>(std::thread::hardware_concurrency())));
+      support::parallel_for_dynamic(
+          0, num_restarts_, num_threads,
+          [&run_climb](int thread_id, int restart) { run_climb(restart); });
+    } else {
+      run_climb(0);
+    }
+#else
+    for (int restart = 0; restart < num_restarts_; ++restart) {
+      run_climb(restart);
+    }
+#endif
+    // prefer plans that fit, then the smallest, then the lowest restart
+    const ClimbResult* best = &climbs[0];
+    for (const auto& climb_result : climbs) {
+      if ((climb_result.fits && !best->fits) ||
+          (climb_result.fits == best->fits && climb_result.total_size < best->total_size)) {
+        best = &climb_result;
+      }
+    }
 
     // return winning combination
-    for (auto it : result_pool_allocations) {
+    for (size_t buf = 0; buf < buffers_.size(); ++buf) {
       // post-check that everything was fit
-      const BufferInfoNode* buf = it.first;
-      const PoolAllocation& pa = it.second;
-      if (NullValue<PoolInfo>().same_as(pa->pool_info) ||
-          !IsValidPlacement(pa->pool_info, pa->byte_offset->value, buf->size_bytes->value)) {
+      int pool = best->placement.pool[buf];
+      size_t offset = best->placement.offset[buf];
+      if (pool < 0 || !is_valid_placement(pool, offset, sizes_[buf])) {
         std::unordered_map<PoolInfo, size_t, ObjectPtrHash, ObjectPtrEqual> m = {};
-        SelectPlacementPool(GetRef<BufferInfo>(buf), m);
+        SelectPlacementPool(buffers_[buf], m);
       }
-      result.Set(GetRef<BufferInfo>(it.first), it.second);
+      result.Set(buffers_[buf],
+                 PoolAllocation(pool < 0 ? NullValue<PoolInfo>() : pools_[pool], Integer(offset)));
     }
     return result;
   }
@@ -361,7 +470,14 @@ class HillClimbAllocator : public GreedyBase {
 
 Map<BufferInfo, PoolAllocation> HillClimb(const Array<BufferInfo>& buffer_info_arr,
                                           const Integer& memory_pressure) {
-  return HillClimbAllocator(memory_pressure.IntValue()).PlanMemory(buffer_info_arr);
+  transform::PassContext pass_ctx = transform::PassContext::Current();
+  int num_restarts = pass_ctx->GetConfig<Integer>(kUSMPHillClimbNumRestartsOption, Integer(1))
+                         .value()
+                         .IntValue();
+  int64_t time_budget_ms =
+      pass_ctx->GetConfig<Integer>(kUSMPHillClimbTimeBudgetOption, Integer(0)).value().IntValue();
+  return HillClimbAllocator(memory_pressure.IntValue(), num_restarts, time_budget_ms)
+      .PlanMemory(buffer_info_arr);
 }
 
 TVM_REGISTER_GLOBAL("tir.usmp.algo.hill_climb")
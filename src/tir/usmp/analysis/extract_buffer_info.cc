@@ -34,6 +34,7 @@
 #include <tvm/tir/usmp/analysis.h>
 #include <tvm/tir/usmp/utils.h>
 
+#include <algorithm>
 #include <stack>
 
 #include "../../../runtime/thread_storage_scope.h"
@@ -79,11 +80,17 @@ class BufferInfoExtractor : public StmtExprVisitor {
   void VisitExpr_(const BufferLoadNode* op) override;
   void VisitStmt_(const BufferStoreNode* op) override;
   void VisitStmt_(const ForNode* op) override;
+  void VisitStmt_(const AttrStmtNode* op) override;
 
   void UpdateAliases(const Array<PrimExpr>& args, const PrimFunc& func);
   void RecordAllocateNodeInfo(const AllocateNode* op);
   void RecordAllocateConstNodeInfo(const AllocateConstNode* op);
   void VisitPrimFunc(const PrimFunc& func, const Call& call);
+  /*!
+   * \brief Extend the liveness of all buffers accessed within a parallel dispatch scope
+   * to the whole scope, as its tasks may run concurrently.
+   */
+  void ExtendLivenessToParallelRegion(int start_stmt_idx, int end_stmt_idx);
 
   /*!
    * \brief Maintains the mapping of BufferInfo to their associated TIR Statements.
@@ -384,6 +391,31 @@ void BufferInfoExtractor::VisitStmt_(const ForNode* op) {
   scope_stack_.pop();
 }
 
+void BufferInfoExtractor::VisitStmt_(const AttrStmtNode* op) {
+  int start_stmt_idx = current_stmt_idx_;
+  StmtExprVisitor::VisitStmt_(op);
+  if (op->attr_key == attr::parallel_dispatch) {
+    ExtendLivenessToParallelRegion(start_stmt_idx, current_stmt_idx_);
+  }
+}
+
+void BufferInfoExtractor::ExtendLivenessToParallelRegion(int start_stmt_idx, int end_stmt_idx) {
+  for (auto& kv : buffer_info_start_stmt_idx_) {
+    Map<tir::Stmt, Integer>& ends = buffer_info_end_stmt_idx_[kv.first];
+    Map<tir::Stmt, Integer> starts = kv.second;
+    for (const auto& start_kv : starts) {
+      const tir::Stmt& allocate = start_kv.first;
+      int start = start_kv.second.IntValue();
+      int end = ends.count(allocate) ? ends[allocate].IntValue() : start;
+      if (start > end_stmt_idx || end < start_stmt_idx) {
+        continue;
+      }
+      kv.second.Set(allocate, std::min(start, start_stmt_idx));
+      ends.Set(allocate, std::max(end, end_stmt_idx));
+    }
+  }
+}
+
 void BufferInfoExtractor::VisitExpr_(const BufferLoadNode* op) {
   this->VisitExpr(op->buffer->data);
   StmtExprVisitor::VisitExpr_(op);
@@ -42,6 +42,8 @@ TVM_REGISTER_PASS_CONFIG_OPTION(kUSMPEnableOption, Bool);
 TVM_REGISTER_PASS_CONFIG_OPTION(kUSMPAlgorithmOption, String);
 TVM_REGISTER_PASS_CONFIG_OPTION(kUSMPUseWorkspaceIO, Bool);
 TVM_REGISTER_PASS_CONFIG_OPTION(kUSMPCustomAlgorithmOption, String);
+TVM_REGISTER_PASS_CONFIG_OPTION(kUSMPHillClimbNumRestartsOption, Integer);
+TVM_REGISTER_PASS_CONFIG_OPTION(kUSMPHillClimbTimeBudgetOption, Integer);
 
 namespace tir {
 namespace usmp {
@@ -75,3 +75,39 @@ TEST(ConstantFold, Ramp) {
   auto f32x4_expected = tvm::tir::Cast(tvm::DataType::Float(32, 4), i32x4);
   ASSERT_TRUE(checker(f32x4, f32x4_expected));
 }
+
+TEST(Simplify, Memoize) {
+  tvm::arith::Analyzer ana;
+  auto x = tvm::te::var("x");
+  auto e = tvm::floordiv(x, 4) * 4 + tvm::floormod(x, 4);
+
+  auto first = ana.Simplify(e);
+  ASSERT_GE(ana.simplify_cache.misses(), 1);
+  // A structurally equal expression is answered from the cache.
+  int64_t hits = ana.simplify_cache.hits();
+  auto second = ana.Simplify(tvm::floordiv(x, 4) * 4 + tvm::floormod(x, 4));
+  ASSERT_EQ(ana.simplify_cache.hits(), hits + 1);
+  ASSERT_TRUE(tvm::StructuralEqual()(first, second));
+
+  // An unchanged expression keeps its identity.
+  auto y = tvm::te::var("y");
+  auto unchanged = x * y;
+  ASSERT_TRUE(ana.Simplify(unchanged).same_as(unchanged));
+  ASSERT_TRUE(ana.Simplify(unchanged).same_as(unchanged));
+}
+
+TEST(Simplify, MemoizeRespectsConstraints) {
+  tvm::arith::Analyzer ana;
+  auto x = tvm::te::var("x");
+  auto cond = x < 10;
+  ASSERT_FALSE(tvm::tir::is_one(ana.Simplify(cond)));
+  {
+    tvm::With<tvm::arith::ConstraintContext> scope(&ana, x < 5);
+    ASSERT_TRUE(tvm::tir::is_one(ana.Simplify(cond)));
+  }
+  ASSERT_FALSE(tvm::tir::is_one(ana.Simplify(cond)));
+
+  // Binding the variable invalidates what was memoized before.
+  ana.Bind(x, tvm::Range::FromMinExtent(0, 8));
+  ASSERT_TRUE(tvm::tir::is_one(ana.Simplify(cond)));
+}
@@ -20,6 +20,9 @@
 #include <dmlc/logging.h>
 #include <gtest/gtest.h>
 #include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/registry.h>
+
+#include <vector>
 
 using namespace tvm;
 
@@ -71,3 +74,92 @@ TEST(NDArrayTest, IsContiguous_UncontiguousStride) {
   managed_tensor->dl_tensor.strides = nullptr;
   managed_tensor->deleter(managed_tensor);
 }
+
+TEST(NDArrayTest, CopyStrided) {
+  const runtime::PackedFunc* fcopy = runtime::Registry::Get("runtime.NDArrayCopyStrided");
+  ASSERT_NE(fcopy, nullptr);
+  auto src = runtime::NDArray::Empty({3, 4}, DataType::Float(32), {kDLCPU, 0});
+  float* src_data = static_cast<float*>(src->data);
+  for (int i = 0; i < 12; ++i) src_data[i] = static_cast<float>(i);
+
+  // Transposed view of src.
+  std::vector<int64_t> strides = {1, 4};
+  auto view = src.CreateView({4, 3}, DataType::Float(32));
+  const_cast<DLTensor*>(view.operator->())->strides = strides.data();
+
+  auto dst = runtime::NDArray::Empty({4, 3}, DataType::Float(32), {kDLCPU, 0});
+  (*fcopy)(view, dst);
+  const float* dst_data = static_cast<const float*>(dst->data);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_EQ(dst_data[i * 3 + j], src_data[j * 4 + i]);
+    }
+  }
+}
+
+TEST(NDArrayTest, CopyToStridedView) {
+  auto src = runtime::NDArray::Empty({3, 4}, DataType::Float(32), {kDLCPU, 0});
+  float* src_data = static_cast<float*>(src->data);
+  for (int i = 0; i < 12; ++i) src_data[i] = static_cast<float>(i);
+
+  // Transposed view of src, copied into a compact array and back into a strided one.
+  std::vector<int64_t> strides = {1, 4};
+  auto view = src.CreateView({4, 3}, DataType::Float(32));
+  const_cast<DLTensor*>(view.operator->())->strides = strides.data();
+
+  auto dst = view.CopyTo({kDLCPU, 0});
+  const float* dst_data = static_cast<const float*>(dst->data);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_EQ(dst_data[i * 3 + j], src_data[j * 4 + i]);
+    }
+  }
+
+  auto back = runtime::NDArray::Empty({3, 4}, DataType::Float(32), {kDLCPU, 0});
+  auto back_view = back.CreateView({4, 3}, DataType::Float(32));
+  const_cast<DLTensor*>(back_view.operator->())->strides = strides.data();
+  dst.CopyTo(back_view);
+  const float* back_data = static_cast<const float*>(back->data);
+  for (int i = 0; i < 12; ++i) {
+    EXPECT_EQ(back_data[i], src_data[i]);
+  }
+}
+
+TEST(NDArrayTest, CastAndFill) {
+  const runtime::PackedFunc* fcast = runtime::Registry::Get("runtime.NDArrayCast");
+  const runtime::PackedFunc* ffill = runtime::Registry::Get("runtime.NDArrayFill");
+  ASSERT_NE(fcast, nullptr);
+  ASSERT_NE(ffill, nullptr);
+
+  auto fp32 = runtime::NDArray::Empty({8}, DataType::Float(32), {kDLCPU, 0});
+  auto bf16 = runtime::NDArray::Empty({8}, DataType::BFloat(16), {kDLCPU, 0});
+  auto int8 = runtime::NDArray::Empty({8}, DataType::Int(8), {kDLCPU, 0});
+  float* fp32_data = static_cast<float*>(fp32->data);
+
+  (*ffill)(fp32, 2.5);
+  fp32_data[1] = 300.0f;
+  fp32_data[2] = -3.0f;
+  (*fcast)(fp32, int8);
+  const int8_t* int8_data = static_cast<const int8_t*>(int8->data);
+  EXPECT_EQ(int8_data[0], 2);  // Round to nearest even.
+  EXPECT_EQ(int8_data[1], 127);
+  EXPECT_EQ(int8_data[2], -3);
+
+  (*fcast)(fp32, bf16);
+  (*ffill)(fp32, 0.0);
+  (*fcast)(bf16, fp32);
+  EXPECT_EQ(fp32_data[0], 2.5f);
+  EXPECT_EQ(fp32_data[2], -3.0f);
+
+  auto fp16 = runtime::NDArray::Empty({8}, DataType::Float(16), {kDLCPU, 0});
+  fp32_data[0] = 65520.0f;  // Rounds to infinity.
+  fp32_data[1] = 1e-7f;     // Subnormal.
+  fp32_data[2] = -1.0f / 3.0f;
+  (*fcast)(fp32, fp16);
+  const uint16_t* fp16_data = static_cast<const uint16_t*>(fp16->data);
+  EXPECT_EQ(fp16_data[0], 0x7c00);
+  EXPECT_EQ(fp16_data[1], 0x0002);
+  EXPECT_EQ(fp16_data[2], 0xb555);
+  (*fcast)(fp16, fp32);
+  EXPECT_EQ(fp32_data[1], 2.0f / (1 << 24));
+}
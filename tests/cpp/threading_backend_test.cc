@@ -124,6 +124,23 @@ TEST(ThreadingBackend, TVMBackendParallelLaunch) {
   EXPECT_EQ(acc.load(std::memory_order_relaxed), N * (N - 1) / 2);
 }
 
+TEST(ThreadingBackend, TVMBackendParallelDispatch) {
+  // Every dispatched task launches a parallel job, which must run inline.
+  constexpr int num_dispatch_tasks = 8;
+  std::atomic<size_t> accs[num_dispatch_tasks];
+  for (auto& acc : accs) acc.store(0);
+  FTVMParallelLambda dispatch_task = [](int task_id, TVMParallelGroupEnv* penv,
+                                        void* cdata) -> int {
+    EXPECT_EQ(penv->num_task, 1);
+    auto* accs = reinterpret_cast<std::atomic<size_t>*>(cdata);
+    return TVMBackendParallelLaunch(atomic_add_task_id, &accs[task_id], 0);
+  };
+  EXPECT_EQ(TVMBackendParallelDispatch(dispatch_task, accs, num_dispatch_tasks), 0);
+  for (auto& acc : accs) {
+    EXPECT_EQ(acc.load(std::memory_order_relaxed), N * (N - 1) / 2);
+  }
+}
+
 TEST(ThreadingBackend, TVMBackendParallelLaunchMultipleThreads) {
   // TODO(tulloch) use parameterised tests when available.
   size_t num_jobs_per_thread = 3;
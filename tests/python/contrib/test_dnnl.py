@@ -995,6 +995,40 @@ def test_dense_pattern(run_module, dtype="float32"):
     run_and_verify_func(config, run_module=run_module, dtype=dtype)
 
 
+@has_dnnl_codegen
+@tvm.testing.requires_llvm
+def test_dense_batch_size_graph_cache(dtype="float32"):
+    def collect_modules(mod):
+        yield mod
+        for imported in mod.imported_modules:
+            yield from collect_modules(imported)
+
+    # The leading dim of the constant kernel matches the compiled batch size, it must not be
+    # rewritten when rebuilding the primitives for another batch size.
+    x_shape = (4, 16)
+    k_shape = (4, 16)
+    dense, _, _ = get_dense(x_shape, k_shape, dtype=dtype)
+    kernel = np.random.uniform(-1, 1, k_shape).astype(dtype)
+    mod = partition_for_dnnl(tvm.IRModule.from_expr(dense), {"kernel": kernel})
+    with tvm.transform.PassContext(opt_level=3):
+        lib = relay.build(mod, target="llvm", params={"kernel": kernel})
+
+    modules = list(collect_modules(lib.get_lib()))
+    dnnl_mod = next(m for m in modules if m.type_key == "dnnl_json")
+    loader = next(m for m in modules if m.type_key == "const_loader")
+    symbol = dnnl_mod["get_symbol"]()
+    run = loader[symbol]
+
+    dev = tvm.cpu()
+    for batch_size in [4, 7, 4, 7, 1]:
+        x = np.random.uniform(-1, 1, (batch_size, x_shape[1])).astype(dtype)
+        out = tvm.nd.empty((batch_size, k_shape[0]), dtype, dev)
+        run(tvm.nd.array(x, dev), out)
+        tvm.testing.assert_allclose(out.numpy(), x @ kernel.T, rtol=1e-5, atol=1e-5)
+    # One build per distinct batch size, revisited batch sizes reuse the cached graphs.
+    assert dnnl_mod["get_num_graph_builds"]() == 3
+
+
 def test_pool2d(run_module, dtype="float32"):
     def get_graph(
         op,
@@ -16,8 +16,10 @@
 # under the License.
 """AOT with C++ Runtime Tests"""
 
+import os
 import re
 import textwrap
+import threading
 
 import numpy as np
 import pytest
@@ -122,6 +124,68 @@ def test_conv2d(enable_usmp, target_kind):
     assert (runner.get_output(0).numpy() == list(ref_outputs.values())[0]).all()
 
 
+@pytest.mark.parametrize("enable_usmp", [True, False])
+def test_parallel_dispatch(enable_usmp):
+    """Tests independent branches dispatched in parallel from the AOT main function"""
+    data = relay.var("data", shape=(1, 16, 32, 32), dtype="float32")
+    branches = [relay.nn.relu(data + relay.const(float(i))) for i in range(4)]
+    branches = [relay.nn.max_pool2d(b, pool_size=(2, 2)) for b in branches]
+    out = relay.concatenate(branches, axis=1)
+    ir_mod = IRModule.from_expr(relay.Function([data], out))
+
+    input_data = np.random.uniform(-1, 1, (1, 16, 32, 32)).astype("float32")
+    inputs = {"data": input_data}
+    ref_outputs = generate_ref_data(ir_mod, inputs)
+
+    with tvm.transform.PassContext(opt_level=3, config={"tir.usmp.enable": enable_usmp}):
+        mod = tvm.relay.build(
+            ir_mod,
+            target="llvm",
+            executor=backend.Executor(
+                "aot", {"interface-api": "packed", "parallel-dispatch": True}
+            ),
+        )
+    llvm_ir = mod.lib.get_source("ll")
+    assert "TVMBackendParallelDispatch" in llvm_ir
+    # the dispatched operators have parallel loops of their own
+    assert "TVMBackendParallelLaunch" in llvm_ir
+
+    temp_dir = tvm.contrib.utils.TempDirectory()
+    test_so_path = temp_dir / "test.so"
+    mod.export_library(test_so_path, cc="gcc", options=["-std=c11", "-g3", "-O0"])
+    loaded_mod = tvm.runtime.load_module(test_so_path)
+    runner = tvm.runtime.executor.AotModule(loaded_mod["default"](tvm.cpu(0)))
+    runner.set_input(**inputs)
+    runner.run()
+    tvm.testing.assert_allclose(runner.get_output(0).numpy(), list(ref_outputs.values())[0])
+
+
+@pytest.mark.parametrize("enable_usmp", [True, False])
+def test_parallel_dispatch_multithreaded(enable_usmp):
+    """Runs test_parallel_dispatch with a multithreaded pool, where the parallel kernels of
+    dispatched operators launch while other operators of their wave are running"""
+    config_threadpool = tvm.get_global_func("runtime.config_threadpool")
+    cpus = sorted(os.sched_getaffinity(0))
+    errors = []
+
+    def test_body():
+        # four workers sharing the available cores, even on hosts with fewer cores
+        config_threadpool(-3, 4, [str(cpus[i % len(cpus)]) for i in range(4)])
+        try:
+            test_parallel_dispatch(enable_usmp)
+        except Exception as err:  # pylint: disable=broad-except
+            errors.append(err)
+        finally:
+            config_threadpool(1, 0)
+
+    # The thread pool is thread local, configure it on a thread of its own
+    thread = threading.Thread(target=test_body)
+    thread.start()
+    thread.join()
+    if errors:
+        raise errors[0]
+
+
 @pytest.mark.parametrize("enable_usmp", [True, False])
 @pytest.mark.parametrize("target_kind", ["c", "llvm"])
 def test_mobilenet(enable_usmp: bool, target_kind: str):
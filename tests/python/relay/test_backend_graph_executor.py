@@ -138,6 +138,69 @@ def test_with_params():
     tvm.testing.assert_allclose(res, ref_res, atol=1e-5, rtol=1e-5)
 
 
+def test_weight_packing_at_load_time():
+    x = relay.var("x", shape=(4, 16))
+    w = relay.var("w", shape=(16, 8))
+    y = relay.nn.dense(x, relay.layout_transform(w, "NC", "CN"))
+    func = relay.Function([x, w], y)
+    w_data = np.random.rand(16, 8).astype("float32")
+    config = {"relay.FoldConstant.skip_layout_transform": True}
+    with tvm.transform.PassContext(opt_level=3, config=config):
+        lib = relay.build(tvm.IRModule.from_expr(func), "llvm", params={"w": w_data})
+    graph = json.loads(lib.get_graph_json())
+    assert any("layout_transform" in node["name"] for node in graph["nodes"])
+
+    # Packing is opt-in, the packing node runs on every inference by default.
+    mod = graph_executor.GraphModule(lib["default"](tvm.cpu(0)))
+    param_name = next(iter(lib.get_params()))
+    x_data = np.random.rand(4, 16).astype("float32")
+    mod.set_input(x=x_data)
+    mod.run()
+    expected = np.dot(x_data, w_data)
+    tvm.testing.assert_allclose(mod.get_output(0).numpy(), expected, atol=1e-5, rtol=1e-5)
+    mod.set_input(param_name, np.zeros((16, 8), "float32"))
+    mod.run()
+    tvm.testing.assert_allclose(mod.get_output(0).numpy(), np.zeros((4, 8)), atol=1e-5, rtol=1e-5)
+
+    # The factory sets the parameters, packing is set up lazily on the first run.
+    mod = graph_executor.GraphModule(lib["default"](tvm.cpu(0)))
+    mod.enable_weight_packing()
+    # The zero copy output binding must survive the executors being set up again for packing.
+    out = tvm.nd.empty((4, 8), "float32")
+    mod.set_output_zero_copy(0, out)
+    # The packed weights must survive across runs with different inputs.
+    for _ in range(3):
+        x_data = np.random.rand(4, 16).astype("float32")
+        mod.set_input(x=x_data)
+        mod.run()
+        tvm.testing.assert_allclose(out.numpy(), np.dot(x_data, w_data), atol=1e-5, rtol=1e-5)
+
+    # Later runs skip the packing node, so a write in place is not seen until repack_weights.
+    mod.set_input(param_name, np.zeros((16, 8), "float32"))
+    mod.run()
+    tvm.testing.assert_allclose(out.numpy(), np.dot(x_data, w_data), atol=1e-5, rtol=1e-5)
+    mod.repack_weights()
+    mod.run()
+    tvm.testing.assert_allclose(out.numpy(), np.zeros((4, 8)), atol=1e-5, rtol=1e-5)
+    # set_param packs the weights again by itself.
+    mod.set_param(param_name, tvm.nd.array(w_data))
+    mod.run()
+    tvm.testing.assert_allclose(out.numpy(), np.dot(x_data, w_data), atol=1e-5, rtol=1e-5)
+
+    # A clone packs the shared parameters into weights of its own, and packs them again when
+    # another executor changes a parameter.
+    clone = mod.clone()
+    clone.set_input(x=x_data)
+    clone.run()
+    expected = np.dot(x_data, w_data)
+    tvm.testing.assert_allclose(clone.get_output(0).numpy(), expected, atol=1e-5, rtol=1e-5)
+    mod.set_param(param_name, tvm.nd.array(np.zeros((16, 8), "float32")))
+    clone.run()
+    tvm.testing.assert_allclose(clone.get_output(0).numpy(), np.zeros((4, 8)), atol=1e-5, rtol=1e-5)
+    mod.run()
+    tvm.testing.assert_allclose(out.numpy(), np.zeros((4, 8)), atol=1e-5, rtol=1e-5)
+
+
 def test_plan_memory():
     # it is sufficient to cycle through two memories.
 
@@ -572,5 +572,70 @@ def test_pass_link_params():
     mod = tvm.relay.transform.FoldConstant()(mod)
 
 
+def test_fold_batched():
+    t = relay.TensorType([2, 3], "float32")
+    w_data = np.random.uniform(size=(3, 2)).astype("float32")
+    b_data = np.random.uniform(size=(2,)).astype("float32")
+
+    def before():
+        x = relay.var("x", t)
+        w = relay.transpose(relay.const(w_data))
+        w = relay.multiply(w, relay.const(2.0))
+        b = relay.split(relay.concatenate([relay.const(b_data)] * 2, axis=0), 2)
+        b = relay.add(relay.TupleGetItem(b.astuple(), 1), relay.const(1.0))
+        cond = relay.greater(relay.sum(relay.const(b_data)), relay.const(-1.0))
+        y = relay.If(cond, relay.add(x, w), x)
+        b_var = relay.var("b", relay.TensorType([2], "float32"))
+        z = relay.Let(b_var, b, relay.nn.bias_add(y, b_var))
+        return relay.Function([x], z)
+
+    def expected():
+        x = relay.var("x", t)
+        w = relay.const(np.transpose(w_data) * 2)
+        b = relay.const(b_data + 1)
+        return relay.Function([x], relay.nn.bias_add(relay.add(x, w), b))
+
+    with tvm.transform.PassContext(config={"relay.FoldConstant.batched": True}):
+        batched = run_opt_pass(before(), transform.FoldConstant())
+    eager = run_opt_pass(before(), transform.FoldConstant())
+    tvm.ir.assert_structural_equal(batched, eager, map_free_vars=True)
+    tvm.ir.assert_structural_equal(
+        batched, run_opt_pass(expected(), transform.InferType()), map_free_vars=True
+    )
+
+
+def test_fold_batched_single_evaluation():
+    t = relay.TensorType([2, 3], "float32")
+    data = [np.random.uniform(size=(2, 3)).astype("float32") for _ in range(3)]
+
+    def before():
+        x = relay.var("x", t)
+        y = x
+        for d in data:
+            y = relay.add(y, relay.add(relay.const(d), relay.const(1.0)))
+        return relay.Function([x], y)
+
+    # The interpreter builds each distinct primitive once per evaluation, so the three identical
+    # additions are built once when their roots are evaluated together, and once each otherwise.
+    default_build = tvm.get_global_func("relay.backend.build")
+    num_builds = [0]
+
+    def counting_build(mod, target):
+        num_builds[0] += 1
+        return default_build(mod, target)
+
+    tvm.register_func("relay.backend.build", counting_build, override=True)
+    try:
+        eager = run_opt_pass(before(), transform.FoldConstant())
+        assert num_builds[0] == len(data)
+        num_builds[0] = 0
+        with tvm.transform.PassContext(config={"relay.FoldConstant.batched": True}):
+            batched = run_opt_pass(before(), transform.FoldConstant())
+        assert num_builds[0] == 1
+    finally:
+        tvm.register_func("relay.backend.build", default_build, override=True)
+    tvm.ir.assert_structural_equal(batched, eager, map_free_vars=True)
+
+
 if __name__ == "__main__":
     tvm.testing.main()
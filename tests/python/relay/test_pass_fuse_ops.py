@@ -944,5 +944,47 @@ def test_fuse_max_num_args(target_name, shape_type):
     assert tvm.ir.structural_equal(fused, expected)
 
 
+def _num_primitive_functions(expr):
+    functions = []
+
+    def _visit(node):
+        if isinstance(node, relay.Function) and "Primitive" in node.attrs.keys():
+            functions.append(node)
+
+    relay.analysis.post_order_visit(expr, _visit)
+    return len(functions)
+
+
+def test_fuse_analytical_cost_model():
+    """The cost model fuses reduction epilogues and refuses expensive broadcasts."""
+
+    def reduce_epilogue():
+        x = relay.var("x", shape=(16, 256))
+        y = relay.sum(x, axis=1)
+        z = relay.exp(y)
+        return relay.Function([x], relay.add(z, relay.const(1.0)))
+
+    def expanding_broadcast():
+        x = relay.var("x", shape=(4096, 1024))
+        a = relay.var("a", shape=(1024,))
+        y = relay.exp(a)
+        return relay.Function([x, a], relay.add(x, y))
+
+    def fuse(func, cost_model):
+        with tvm.transform.PassContext(config={"relay.FuseOps.cost_model": cost_model}):
+            return run_opt_pass(func, transform.FuseOps(fuse_opt_level=2))
+
+    assert _num_primitive_functions(fuse(reduce_epilogue(), "greedy")) == 2
+    assert _num_primitive_functions(fuse(reduce_epilogue(), "analytical")) == 1
+    assert _num_primitive_functions(fuse(expanding_broadcast(), "greedy")) == 1
+    assert _num_primitive_functions(fuse(expanding_broadcast(), "analytical")) == 2
+
+    x_np = np.random.uniform(size=(16, 256)).astype("float32")
+    with tvm.transform.PassContext(opt_level=3, config={"relay.FuseOps.cost_model": "analytical"}):
+        mod = tvm.IRModule.from_expr(reduce_epilogue())
+        result = relay.create_executor("graph", mod=mod, target="llvm").evaluate()(x_np)
+    tvm.testing.assert_allclose(result.numpy(), np.exp(x_np.sum(axis=1)) + 1, rtol=1e-5)
+
+
 if __name__ == "__main__":
     tvm.testing.main()
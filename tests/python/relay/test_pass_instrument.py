@@ -16,11 +16,13 @@
 # under the License.
 """ Instrument test cases.
 """
+import json
+
 import pytest
 import tvm
 import tvm.relay
 from tvm.relay import op
-from tvm.ir.instrument import PassTimingInstrument, pass_instrument
+from tvm.ir.instrument import PassProfilingInstrument, PassTimingInstrument, pass_instrument
 
 
 def get_test_model():
@@ -59,6 +61,36 @@ def test_pass_timing_instrument():
     assert profiles == ""
 
 
+def test_pass_profiling_instrument():
+    profiling = PassProfilingInstrument()
+    seq = tvm.transform.Sequential(
+        [tvm.relay.transform.InferType(), tvm.relay.transform.ToANormalForm()], name="seq"
+    )
+    with tvm.transform.PassContext(instruments=[profiling]):
+        seq(get_test_model())
+
+    report = profiling.render()
+    assert "seq" in report
+    # Nested passes are indented below the sequential pass.
+    assert "\tInferType" in report
+    assert "\tToANormalForm" in report
+    assert "IR nodes" in report
+
+    events = json.loads(profiling.chrome_trace())["traceEvents"]
+    by_name = {event["name"]: event for event in events}
+    assert {"seq", "InferType", "ToANormalForm"} <= set(by_name)
+    seq_event = by_name["seq"]
+    for name in ["InferType", "ToANormalForm"]:
+        event = by_name[name]
+        assert event["ts"] >= seq_event["ts"]
+        assert event["ts"] + event["dur"] <= seq_event["ts"] + seq_event["dur"] + 1e-3
+        if "allocations" in event["args"]:
+            assert event["args"]["allocations"] <= seq_event["args"]["allocations"]
+    # ToANormalForm introduces let bindings.
+    anf = by_name["ToANormalForm"]["args"]
+    assert anf["ir_nodes_after"] > anf["ir_nodes_before"]
+
+
 instrument_definition_type = tvm.testing.parameter("decorator", "subclass")
 
 
@@ -86,5 +86,24 @@ def test_bsr_sparse_dense():
     np.testing.assert_allclose(sparse_output, dense_output, atol=1e-5, rtol=1e-5)
 
 
+def test_bsr_sparse_dense_auto_block_size():
+    data = relay.var("data", shape=(1, 128), dtype="float32")
+    w = relay.var("weight", shape=(768, 128), dtype="float32")
+    y = relay.nn.dense(data, w)
+    func = relay.Function(relay.analysis.free_vars(y), y)
+
+    w_np = random_bsr_matrix(768, 128, 16, 4, 0.1).todense()
+    assert relay.analysis.sparse_dense.select_block_size(np.asarray(w_np)) == (16, 4)
+    params = {"weight": tvm.nd.array(w_np)}
+
+    x_np = np.random.randn(1, 128).astype("float32")
+    dense_output = run_func(func, params, x_np)
+    sparse_func, params = relay.data_dep_optimization.bsr_dense.convert(func, params, "auto", 0.2)
+    assert params["weight.data"].shape[1:] == (16, 4)
+    sparse_output = run_func(sparse_func, params, x_np)
+    np.testing.assert_allclose(sparse_output, dense_output, atol=1e-5, rtol=1e-5)
+
+
 if __name__ == "__main__":
     test_bsr_sparse_dense()
+    test_bsr_sparse_dense_auto_block_size()
@@ -619,5 +619,35 @@ def test_loop(target_precision):
     assert tvm.ir.structural_equal(expected_mod, output_mod)
 
 
+def test_keep_fp32_calls():
+    data = relay.var("data", shape=(1, 16), dtype="float32")
+    weight = relay.const(np.random.uniform(size=(8, 16)).astype("float32"))
+    dense = relay.nn.dense(data, weight)
+    mod = InferType()(tvm.IRModule.from_expr(relay.nn.relu(dense)))
+    key = tvm.relay.transform._ffi_api.MixedPrecisionCallKey(mod["main"].body.args[0])
+    assert key.startswith("nn.dense(")
+
+    with tvm.transform.PassContext(config={"relay.ToMixedPrecision.keep_fp32_calls": [key]}):
+        output_mod = ToMixedPrecision("float16")(mod)
+    assert output_mod["main"].body.checked_type.dtype == "float32"
+    assert ToMixedPrecision("float16")(mod)["main"].body.checked_type.dtype == "float16"
+
+
+def test_tune_mixed_precision():
+    data = relay.var("data", shape=(4, 32), dtype="float32")
+    weight = relay.const(np.random.uniform(-1, 1, size=(16, 32)).astype("float32"))
+    out = relay.nn.relu(relay.nn.dense(data, weight))
+    mod = tvm.IRModule.from_expr(relay.Function([data], out))
+
+    output_mod, report = relay.transform.tune_mixed_precision(
+        mod, "float16", rtol=1e-1, atol=1e-1, number=1, repeat=1
+    )
+    assert len(report) == 2
+    assert report[0]["precision"] in ["float16", "float32"]
+    assert report[-1]["projected_speedup"] > 0
+    expected_dtype = "float16" if report[0]["precision"] == "float16" else "float32"
+    assert output_mod["main"].body.checked_type.dtype == expected_dtype
+
+
 if __name__ == "__main__":
     tvm.testing.main()
@@ -590,5 +590,61 @@ def test_argreduce_infer_return_type():
         )
 
 
+def test_incremental_infer_type():
+    def make_callee(rhs):
+        x = relay.var("x", shape=(4,), dtype="float32")
+        return relay.Function([x], relay.add(x, rhs), relay.TensorType((4,), "float32"))
+
+    mod = tvm.IRModule()
+    callee = relay.GlobalVar("callee")
+    mod[callee] = make_callee(relay.const(1.0))
+    y = relay.var("y", shape=(4,), dtype="float32")
+    mod["main"] = relay.Function([y], relay.multiply(callee(y), y))
+
+    config = {"relay.InferType.incremental": True}
+    with tvm.transform.PassContext(config=config):
+        typed = transform.InferType()(mod)
+        typed_main = typed["main"]
+        typed_callee = typed["callee"]
+        # Nothing changed, so every function is reused as is.
+        retyped = transform.InferType()(typed)
+        assert retyped["main"].same_as(typed_main)
+        assert retyped["callee"].same_as(typed_callee)
+
+        # Only the rewritten function is inferred again.
+        new_callee = make_callee(relay.const(2.0))
+        changed = tvm.IRModule(
+            {
+                typed.get_global_var("main"): typed_main,
+                typed.get_global_var("callee"): new_callee,
+            }
+        )
+        incremental = transform.InferType()(changed)
+        assert incremental["main"].same_as(typed_main)
+        assert not incremental["callee"].same_as(new_callee)
+
+        # A callee inferred to another type invalidates its callers.
+        x = relay.var("x", shape=(4,), dtype="float32")
+        reduced = tvm.IRModule(
+            {
+                typed.get_global_var("main"): typed_main,
+                typed.get_global_var("callee"): relay.Function(
+                    [x], relay.sum(x), relay.TensorType((), "float32")
+                ),
+            }
+        )
+        reduced_typed = transform.InferType()(reduced)
+        assert not reduced_typed["main"].same_as(typed_main)
+        assert reduced_typed["main"].body.args[0].checked_type == relay.TensorType((), "float32")
+
+    full = transform.InferType()(changed)
+    tvm.ir.assert_structural_equal(incremental, full)
+    assert incremental["callee"].body.checked_type == full["callee"].body.checked_type
+
+    # The recorded functions belong to the pass context they were inferred in.
+    with tvm.transform.PassContext(config=config):
+        assert not transform.InferType()(typed)["main"].same_as(typed_main)
+
+
 if __name__ == "__main__":
     tvm.testing.main()
@@ -21,6 +21,7 @@ from unittest.mock import patch
 
 import tvm
 from tvm import runtime
+from tvm.runtime import profiler_vm
 from tvm import relay, IRModule
 from tvm.relay.backend import vm
 from tvm.relay.scope_builder import ScopeBuilder
@@ -705,6 +706,36 @@ def test_vm_optimize_dynamic():
     assert "shape_func" in opt_mod.astext(False)
 
 
+def test_vm_memoize_shape_func():
+    dtype = "float32"
+    x = relay.var("x", shape=(relay.Any(), relay.Any()), dtype=dtype)
+    y = relay.var("y", shape=(relay.Any(), relay.Any()), dtype=dtype)
+    mod = tvm.IRModule()
+    mod["main"] = relay.Function([x, y], relay.add(x, y))
+    comp = relay.vm.VMCompiler()
+    opt_mod, _ = comp.optimize(mod, target="llvm")
+    assert "vm_memoize" in opt_mod.astext(False)
+
+    exe = relay.vm.compile(mod, "llvm")
+    vm = runtime.vm.VirtualMachine(exe, tvm.cpu())
+    get_memoize_stats = vm.module["get_memoize_stats"]
+
+    def run(shapes):
+        for shape in shapes:
+            x_np = np.random.rand(*shape).astype(dtype)
+            y_np = np.random.rand(*shape).astype(dtype)
+            res = vm.invoke("main", x_np, y_np)
+            tvm.testing.assert_allclose(res.numpy(), x_np + y_np)
+        hits, misses = get_memoize_stats()
+        return int(hits), int(misses)
+
+    shapes = [(2, 3), (4, 5), (1, 5)]
+    hits, misses = run(shapes)
+    assert misses > 0
+    # Every shape function call for a shape seen before is served from the memo.
+    assert run(shapes[::-1]) == (hits + misses, misses)
+
+
 def test_vm_optimize():
     mod, params = testing.synthetic.get_workload()
     comp = relay.vm.VMCompiler()
@@ -1563,5 +1594,33 @@ def test_load_late_bound_consts_via_map_with_no_late_bound_consts():
     tvm.testing.assert_allclose(expected, actual.numpy())
 
 
+@pytest.mark.skipif(not profiler_vm.enabled(), reason="VM Profiler not enabled")
+def test_shape_buckets(target, dev):
+    x = relay.var("x", shape=(relay.Any(), 16), dtype="float32")
+    mod = tvm.IRModule.from_expr(relay.Function([x], relay.nn.relu(x) + relay.const(1.0)))
+
+    specialized = relay.transform.SpecializeShapeBuckets([{"x": [8, 16]}, {"x": [32, 16]}])(mod)
+    specialized = relay.transform.InferType()(specialized)
+    bucket = specialized["main_shape_bucket_0"]
+    assert tuple(bucket.params[0].checked_type.shape) == (8, 16)
+    assert tuple(specialized["main_shape_bucket_1"].params[0].checked_type.shape) == (32, 16)
+
+    with tvm.transform.PassContext(
+        opt_level=3, config={"relay.vm.shape_buckets": [{"x": [8, 16]}, {"x": [32, 16]}]}
+    ):
+        exe = relay.vm.compile(mod, target)
+    assert "main_shape_bucket_0" in exe.bytecode
+    vm_exec = runtime.vm.VirtualMachine(exe, dev)
+    vm_prof = profiler_vm.VirtualMachineProfiler(exe, dev)
+    for rows, in_bucket in [(8, True), (32, True), (5, False)]:
+        x_np = np.random.uniform(-1, 1, size=(rows, 16)).astype("float32")
+        res = vm_exec.invoke("main", tvm.nd.array(x_np, dev))
+        tvm.testing.assert_allclose(res.numpy(), np.maximum(x_np, 0) + 1.0)
+        # Only the generic body has dynamic shapes, and so calls shape functions.
+        report = vm_prof.profile(tvm.nd.array(x_np, dev), func_name="main")
+        names = [str(call["Name"]) for call in report.calls]
+        assert any("shape_func" in name for name in names) != in_bucket, names
+
+
 if __name__ == "__main__":
     tvm.testing.main()
@@ -42,6 +42,27 @@ def test_infer_bound():
     dag, s = get_tiled_matmul()
     s = dag.infer_bound_from_state(s)
 
+    # Inferring again on the same steps hits the memoized result and gives the same bounds
+    s2 = dag.infer_bound_from_state(s)
+    assert str(s) == str(s2)
+    s3 = dag.infer_bound_from_state(s.copy())
+    assert str(s) == str(s3)
+
+    # States that replay a cache_write separately have distinct ops for the new stage, a
+    # memoized result must keep the ops of the state it is applied on
+    A, B, C = matmul_auto_scheduler_test(512, 512, 512)
+    dag = auto_scheduler.ComputeDAG([A, B, C])
+    states = []
+    for _ in range(2):
+        state = dag.get_init_state()
+        state.cache_write(C, "global")
+        states.append(state)
+    for state in states:
+        bounded = dag.infer_bound_from_state(state)
+        for stage, bounded_stage in zip(state.stages, bounded.stages):
+            assert stage.op.same_as(bounded_stage.op)
+    assert str(dag.infer_bound_from_state(states[0])) == str(dag.infer_bound_from_state(states[1]))
+
 
 def test_estimate_flop():
     N = 512
@@ -17,7 +17,10 @@
 """ Test Meta Schedule Builder """
 
 import os
+import socket
 import sys
+import tempfile
+import threading
 import time
 from typing import List
 
@@ -26,12 +29,16 @@ import tvm.testing
 
 from tvm import script
 from tvm._ffi import register_func
+from tvm.exec.meta_schedule_worker import _recv_bytes, _send_bytes
 from tvm.meta_schedule.builder import (
     BuilderInput,
     BuilderResult,
     LocalBuilder,
     PyBuilder,
+    WorkerPoolBuilder,
 )
+from tvm.meta_schedule.testing.local_worker import LocalWorkerDaemon
+from tvm.meta_schedule.utils import remove_build_dir
 from tvm.runtime import Module
 from tvm.script import tir as T
 from tvm.target import Target
@@ -225,5 +232,179 @@ def test_meta_schedule_missing_build_func():
         LocalBuilder(f_build="wrong-name")
 
 
+def test_meta_schedule_worker_pool_build():
+    """Test the builds dispatched to worker daemons, where identical modules are built once"""
+    with LocalWorkerDaemon() as daemon:
+        builder = WorkerPoolBuilder(workers=[daemon.address, daemon.address])
+        builder_inputs = [
+            BuilderInput(MatmulModule, Target("llvm")),
+            BuilderInput(MatmulReluModule, Target("llvm")),
+            BuilderInput(MatmulModule, Target("llvm")),
+        ]
+        builder_results = builder.build(builder_inputs)
+        assert len(builder_results) == len(builder_inputs)
+        # The duplicate gets a copy, which outlives the removal of the other build directory
+        assert builder_results[0].artifact_path != builder_results[2].artifact_path
+        remove_build_dir(builder_results[0].artifact_path)
+        assert os.path.exists(builder_results[2].artifact_path)
+        _check_build_results(builder_results[1:])
+
+
+class _ScriptedWorker:
+    """A worker daemon in a thread of the test, which answers the i-th job with `f_job(i, conn)`.
+    `f_job` returns False to stop serving the connection."""
+
+    def __init__(self, f_job):
+        self.f_job = f_job
+        self.num_jobs = 0
+        self.lock = threading.Lock()
+        self.server = socket.socket()
+        self.server.bind(("127.0.0.1", 0))
+        self.server.listen()
+        self.address = "127.0.0.1:%d" % self.server.getsockname()[1]
+        threading.Thread(target=self._serve, daemon=True).start()
+
+    def _serve(self):
+        while True:
+            try:
+                conn, _ = self.server.accept()
+            except OSError:
+                return
+            threading.Thread(target=self._handle, args=(conn,), daemon=True).start()
+
+    def _handle(self, conn):
+        with conn:
+            while _recv_bytes(conn) is not None and _recv_bytes(conn) is not None:
+                with self.lock:
+                    job_id = self.num_jobs
+                    self.num_jobs += 1
+                if not self.f_job(job_id, conn):
+                    return
+
+    def kill(self):
+        """Stop accepting connections, as if the daemon is dead"""
+        try:
+            self.server.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+        self.server.close()
+
+
+def _reply_artifact(_job_id, conn):
+    build_dir = tempfile.mkdtemp()
+    artifact_path = os.path.join(build_dir, "tvm_tmp_mod.tar")
+    with open(artifact_path, "wb"):
+        pass
+    _send_bytes(conn, b"ok")
+    _send_bytes(conn, artifact_path.encode())
+    return True
+
+
+def test_meta_schedule_worker_pool_retry():
+    """Test that a job is retried on a new connection after the worker drops the connection"""
+
+    def f_job(job_id, conn):
+        if job_id == 0:
+            return False
+        return _reply_artifact(job_id, conn)
+
+    worker = _ScriptedWorker(f_job)
+    builder = WorkerPoolBuilder(workers=[worker.address], max_retries=1)
+    (builder_result,) = builder.build([BuilderInput(MatmulModule, Target("llvm"))])
+    assert builder_result.error_msg is None
+    assert os.path.exists(builder_result.artifact_path)
+    assert worker.num_jobs == 2
+    remove_build_dir(builder_result.artifact_path)
+
+
+def test_meta_schedule_worker_pool_lost_heartbeat():
+    """Test that a job is retried after the worker stops sending heartbeats"""
+
+    def f_job(job_id, conn):
+        if job_id == 0:
+            time.sleep(2)
+            return False
+        return _reply_artifact(job_id, conn)
+
+    worker = _ScriptedWorker(f_job)
+    builder = WorkerPoolBuilder(workers=[worker.address], heartbeat_timeout_sec=0.5, max_retries=1)
+    (builder_result,) = builder.build([BuilderInput(MatmulModule, Target("llvm"))])
+    assert builder_result.error_msg is None
+    assert worker.num_jobs == 2
+    remove_build_dir(builder_result.artifact_path)
+
+
+def test_meta_schedule_worker_pool_dead_worker():
+    """Test that the jobs of a worker dying in the middle of a job go to the other workers"""
+
+    def f_dying_job(_job_id, _conn):
+        dying.kill()
+        return False
+
+    dying = _ScriptedWorker(f_dying_job)
+    alive = _ScriptedWorker(_reply_artifact)
+    builder = WorkerPoolBuilder(workers=[dying.address, alive.address], max_retries=1)
+    builder_results = builder.build(
+        [
+            BuilderInput(MatmulModule, Target("llvm")),
+            BuilderInput(MatmulReluModule, Target("llvm")),
+        ]
+    )
+    for builder_result in builder_results:
+        assert builder_result.error_msg is None
+        remove_build_dir(builder_result.artifact_path)
+    assert dying.num_jobs <= 1
+    assert alive.num_jobs == 2
+
+
+def test_meta_schedule_worker_pool_timeout():
+    """Test that a job still running after the timeout fails without retry"""
+
+    def f_job(_job_id, conn):
+        try:
+            while True:
+                _send_bytes(conn, b"heartbeat")
+                time.sleep(0.1)
+        except OSError:
+            return False
+
+    worker = _ScriptedWorker(f_job)
+    builder = WorkerPoolBuilder(workers=[worker.address], timeout_sec=1, max_retries=2)
+    (builder_result,) = builder.build([BuilderInput(MatmulModule, Target("llvm"))])
+    assert builder_result.artifact_path is None
+    assert builder_result.error_msg.startswith("Timeout")
+    assert worker.num_jobs == 1
+
+
+def test_meta_schedule_worker_pool_build_once():
+    """Test that duplicate modules in a batch and across batches are built only once"""
+    worker = _ScriptedWorker(_reply_artifact)
+    builder = WorkerPoolBuilder(workers=[worker.address, worker.address])
+    builder_results = builder.build(
+        [
+            BuilderInput(MatmulModule, Target("llvm")),
+            BuilderInput(MatmulReluModule, Target("llvm")),
+            BuilderInput(MatmulModule, Target("llvm")),
+        ]
+    )
+    assert worker.num_jobs == 2
+    builder_results += builder.build([BuilderInput(MatmulReluModule, Target("llvm"))])
+    assert worker.num_jobs == 2
+    assert len({result.artifact_path for result in builder_results}) == len(builder_results)
+    for builder_result in builder_results:
+        assert builder_result.error_msg is None
+        remove_build_dir(builder_result.artifact_path)
+
+
+def test_meta_schedule_worker_pool_no_worker():
+    with socket.socket() as sock:
+        sock.bind(("127.0.0.1", 0))
+        port = sock.getsockname()[1]
+    builder = WorkerPoolBuilder(workers=[f"127.0.0.1:{port}"], max_retries=0)
+    (builder_result,) = builder.build([BuilderInput(MatmulModule, Target("llvm"))])
+    assert builder_result.artifact_path is None
+    assert builder_result.error_msg == "No meta schedule worker is available"
+
+
 if __name__ == "__main__":
     tvm.testing.main()
@@ -36,6 +36,7 @@ from tvm.meta_schedule.runner import (
     RPCRunner,
     RunnerFuture,
     RunnerInput,
+    WorkerPoolRunner,
 )
 from tvm.meta_schedule.runner.local_runner import (
     default_alloc_argument as local_default_alloc_argument,
@@ -48,6 +49,7 @@ from tvm.meta_schedule.runner.rpc_runner import (
     default_alloc_argument as rpc_default_alloc_argument,
 )
 from tvm.meta_schedule.testing.local_rpc import LocalRPC
+from tvm.meta_schedule.testing.local_worker import LocalWorkerDaemon
 from tvm.meta_schedule.utils import (
     derived_object,
     get_global_func_with_default_on_worker,
@@ -902,5 +904,44 @@ def test_meta_schedule_local_runner_add_test():
     _clean_build(builder_result.artifact_path)
 
 
+def test_meta_schedule_worker_pool_runner():
+    """Test the measurements dispatched to a worker daemon"""
+    (builder_result,) = LocalBuilder().build([BuilderInput(MatmulModule, Target("llvm"))])
+    assert builder_result.error_msg is None
+    args_info = [
+        TensorInfo("float32", (MATMUL_N, MATMUL_N)),
+        TensorInfo("float32", (MATMUL_N, MATMUL_N)),
+        TensorInfo("float32", (MATMUL_N, MATMUL_N)),
+    ]
+    runner_inputs = [
+        RunnerInput(builder_result.artifact_path, "llvm", args_info),
+        RunnerInput(builder_result.artifact_path + ".missing", "llvm", args_info),
+        RunnerInput(builder_result.artifact_path, "llvm", args_info),
+    ]
+    evaluator_config = EvaluatorConfig(
+        number=1,
+        repeat=2,
+        min_repeat_ms=0,
+        enable_cpu_cache_flush=False,
+    )
+    with LocalWorkerDaemon() as daemon:
+        runner = WorkerPoolRunner(
+            workers=[daemon.address, daemon.address], evaluator_config=evaluator_config
+        )
+        runner_futures = runner.run(runner_inputs)
+        runner_results = [runner_future.result() for runner_future in runner_futures]
+    assert runner_results[1].run_secs is None
+    assert runner_results[1].error_msg is not None
+    for runner_result in [runner_results[0], runner_results[2]]:
+        assert runner_result.error_msg is None
+        assert len(runner_result.run_secs) == 2
+        for result in runner_result.run_secs:
+            if isinstance(result, FloatImm):
+                result = result.value
+            assert isinstance(result, float)
+            assert result >= 0.0
+    _clean_build(builder_result.artifact_path)
+
+
 if __name__ == "__main__":
     tvm.testing.main()
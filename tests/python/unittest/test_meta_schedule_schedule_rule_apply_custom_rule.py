@@ -17,12 +17,19 @@
 # pylint: disable=missing-module-docstring,missing-function-docstring,missing-class-docstring
 from typing import List
 import tempfile
+
+import numpy as np
 import pytest
+import scipy.sparse as sp
 
 import tvm
+import tvm.testing
 from tvm import meta_schedule as ms
+from tvm import te, topi
 from tvm.meta_schedule.schedule_rule import ApplyCustomRule
+from tvm.meta_schedule.testing.space_generation import generate_design_space
 from tvm.script import tir as T
+from tvm.target import Target
 
 
 @tvm.script.ir_module
@@ -62,5 +69,44 @@ def test_custom_rule():
     assert "Intended for meta_schedule.cpu.test_apply_custom_rule" in str(e_info.value)
 
 
+def test_sparse_dense_bsr_rule():
+    data = te.placeholder((128, 256), name="data")
+    w_data = te.placeholder((64, 16, 1), name="w_data")
+    w_indices = te.placeholder((64,), name="w_indices", dtype="int32")
+    w_indptr = te.placeholder((9,), name="w_indptr", dtype="int32")
+    out = topi.nn.sparse_dense(data, w_data, w_indices, w_indptr)
+    mod = tvm.IRModule({"main": te.create_prim_func([data, w_data, w_indices, w_indptr, out])})
+    (space,) = generate_design_space(
+        kind="llvm",
+        mod=mod,
+        target=Target("llvm --num-cores=4"),
+        types=None,
+        sch_rules=[ApplyCustomRule()],
+    )
+    insts = [inst.kind.name for inst in space.trace.insts]
+    for kind in ["SamplePerfectTile", "Split", "Reorder", "Parallel", "Vectorize"]:
+        assert kind in insts
+    # Eight 16x1 blocks in each of the 8 block rows of a 128x256 weight
+    rng = np.random.default_rng(0)
+    indices = np.concatenate([np.sort(rng.choice(256, 8, replace=False)) for _ in range(8)])
+    indptr = np.arange(0, 65, 8)
+    weight = sp.bsr_matrix(
+        (rng.uniform(size=(64, 16, 1)).astype("float32"), indices, indptr), shape=(128, 256)
+    )
+    data_np = rng.uniform(size=(128, 256)).astype("float32")
+    func = tvm.build(space.mod, target="llvm")
+    dev = tvm.cpu()
+    args = [
+        tvm.nd.array(data_np, dev),
+        tvm.nd.array(weight.data, dev),
+        tvm.nd.array(weight.indices.astype("int32"), dev),
+        tvm.nd.array(weight.indptr.astype("int32"), dev),
+        tvm.nd.empty((128, 128), "float32", dev),
+    ]
+    func(*args)
+    tvm.testing.assert_allclose(args[-1].numpy(), data_np @ weight.T.toarray(), rtol=1e-5)
+
+
 if __name__ == "__main__":
     test_custom_rule()
+    test_sparse_dense_bsr_rule()
@@ -884,5 +884,38 @@ def test_max_pool_blocked():
     )
 
 
+def test_cpu_matmul_pipeline():
+    mod = te.create_prim_func(te_workload.matmul(512, 512, 512))
+    actual = generate_design_space(
+        kind="llvm",
+        mod=mod,
+        target=Target("llvm"),
+        types=None,
+        sch_rules=[
+            ms.schedule_rule.MultiLevelTilingCPUPipeline(
+                structure="SSRSRS",
+                max_innermost_factor=64,
+                reuse_read=ms.schedule_rule.ReuseType(req="must", levels=[2], scope="global"),
+                prefetch_distances=[0, 2],
+            )
+        ],
+    )
+    annotations = []
+
+    def _collect(stmt):
+        if isinstance(stmt, tvm.tir.For) and "software_pipeline_stage" in stmt.annotations:
+            annotations.append(stmt.annotations)
+
+    for sch in actual:
+        tvm.tir.stmt_functor.post_order_visit(sch.mod["main"].body, _collect)
+    # One sketch without pipelining, and one for each prefetch distance.
+    assert len(actual) == 3
+    assert len(annotations) == 2
+    for annotation in annotations:
+        assert list(annotation["software_pipeline_stage"]) == [0, 0, 1]
+        assert list(annotation["software_pipeline_order"]) == [0, 1, 2]
+    assert [int(a.get("software_pipeline_prefetch", 0)) for a in annotations] == [0, 2]
+
+
 if __name__ == "__main__":
     tvm.testing.main()
@@ -0,0 +1,106 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+# pylint: disable=missing-module-docstring,missing-function-docstring,missing-class-docstring
+import tvm
+from tvm import meta_schedule as ms
+from tvm.meta_schedule.testing.space_generation import (
+    check_sketches,
+    generate_design_space,
+)
+from tvm.script import tir as T
+from tvm.target import Target
+
+# fmt: off
+# pylint: disable=no-member,invalid-name,unused-variable,no-self-argument,line-too-long,chained-comparison,not-callable,too-many-nested-blocks
+
+@tvm.script.ir_module
+class Gather:
+    @T.prim_func
+    def main(A: T.Buffer((4096, 64), "float32"), B: T.Buffer((128,), "int32"), C: T.Buffer((128, 64), "float32")) -> None:
+        T.func_attr({"global_symbol": "main"})
+        for i, j in T.grid(128, 64):
+            with T.block("C"):
+                vi, vj = T.axis.remap("SS", [i, j])
+                C[vi, vj] = A[B[vi], vj]
+
+
+@tvm.script.ir_module
+class Add:
+    @T.prim_func
+    def main(A: T.Buffer((128, 64), "float32"), C: T.Buffer((128, 64), "float32")) -> None:
+        T.func_attr({"global_symbol": "main"})
+        for i, j in T.grid(128, 64):
+            with T.block("C"):
+                vi, vj = T.axis.remap("SS", [i, j])
+                C[vi, vj] = A[vi, vj] + T.float32(1)
+
+# pylint: enable=no-member,invalid-name,unused-variable,no-self-argument,line-too-long,chained-comparison,not-callable,too-many-nested-blocks
+# fmt: on
+
+
+def test_software_prefetch_gather():
+    @T.prim_func
+    def Gather_0(
+        A: T.Buffer((4096, 64), "float32"),
+        B: T.Buffer((128,), "int32"),
+        C: T.Buffer((128, 64), "float32"),
+    ) -> None:
+        T.func_attr({"global_symbol": "main"})
+        with T.block("root"):
+            T.reads()
+            T.writes()
+            T.block_attr({"pragma_software_prefetch": 8})
+            for i, j in T.grid(128, 64):
+                with T.block("C"):
+                    vi, vj = T.axis.remap("SS", [i, j])
+                    C[vi, vj] = A[B[vi], vj]
+
+    decision_0 = [
+        ("SampleCategorical", 2),
+    ]
+
+    actual = generate_design_space(
+        kind="llvm",
+        mod=Gather,
+        target=Target("llvm --num-cores=32"),
+        types=None,
+        sch_rules=[ms.schedule_rule.SoftwarePrefetch(prefetch_distances=[0, 4, 8])],
+    )
+    check_sketches(
+        Gather,
+        sketches=actual,
+        expected_mods=[Gather_0],
+        expected_decisions=[decision_0],
+    )
+
+
+def test_software_prefetch_spatial():
+    actual = generate_design_space(
+        kind="llvm",
+        mod=Add,
+        target=Target("llvm --num-cores=32"),
+        types=None,
+        sch_rules=[ms.schedule_rule.SoftwarePrefetch(prefetch_distances=[0, 4, 8])],
+    )
+    assert len(actual) == 1
+    trace = actual[0].trace.simplified(remove_postproc=True)
+    assert not trace.insts
+
+
+if __name__ == "__main__":
+    test_software_prefetch_gather()
+    test_software_prefetch_spatial()
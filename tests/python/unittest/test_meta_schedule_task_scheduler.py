@@ -436,6 +436,89 @@ def test_meta_schedule_task_scheduler_gradient_based_with_null_search_strategy()
     assert len(database.get_top_k(database.commit_workload(MatmulReluModule), 100)) == 10
 
 
+def test_meta_schedule_task_scheduler_convergence_aware():
+    num_trials_per_iter = 6
+    tasks = [
+        ms.TuneContext(
+            MatmulModule,
+            target=tvm.target.Target("llvm"),
+            space_generator=_schedule_matmul,
+            search_strategy=ms.search_strategy.ReplayTrace(),
+            task_name="Matmul",
+            rand_state=42,
+        ),
+        ms.TuneContext(
+            BatchMatmulModule,
+            target=tvm.target.Target("llvm"),
+            space_generator=_schedule_batch_matmul,
+            search_strategy=ms.search_strategy.ReplayTrace(),
+            task_name="BatchMatmul",
+            rand_state=0x114514,
+        ),
+    ]
+    database = ms.database.MemoryDatabase()
+    # Any improvement below 100% counts as converged, so each task stops after two rounds and
+    # leaves the rest of the budget unused
+    scheduler = ms.task_scheduler.ConvergenceAware(patience=1, min_improvement=1.0)
+    scheduler.tune(
+        tasks,
+        task_weights=[1.0, 1.0],
+        builder=DummyBuilder(),
+        runner=DummyRunner(),
+        database=database,
+        measure_callbacks=[ms.measure_callback.AddToDatabase()],
+        max_trials_global=200,
+        max_trials_per_task=100,
+        num_trials_per_iter=num_trials_per_iter,
+        cost_model=None,
+    )
+    for task in tasks:
+        assert (
+            len(database.get_top_k(database.commit_workload(task.mod), 10000))
+            == 2 * num_trials_per_iter
+        )
+
+
+def test_meta_schedule_task_scheduler_convergence_aware_warm_start():
+    num_trials_per_iter = 6
+    database = ms.database.MemoryDatabase()
+
+    def tune(mod, space, task_name):
+        task = ms.TuneContext(
+            mod,
+            target=tvm.target.Target("llvm"),
+            space_generator=space,
+            search_strategy=ms.search_strategy.ReplayTrace(),
+            task_name=task_name,
+            rand_state=42,
+        )
+        ms.task_scheduler.ConvergenceAware(patience=0, warm_start_top_k=1).tune(
+            [task],
+            task_weights=[1.0],
+            builder=DummyBuilder(),
+            runner=DummyRunner(),
+            database=database,
+            measure_callbacks=[ms.measure_callback.AddToDatabase()],
+            max_trials_global=num_trials_per_iter,
+            max_trials_per_task=num_trials_per_iter,
+            num_trials_per_iter=num_trials_per_iter,
+            cost_model=None,
+        )
+        return database.get_top_k(database.commit_workload(mod), 10000)
+
+    def has_split(record):
+        return any(inst.kind.name == "Split" for inst in record.trace.insts)
+
+    # Nothing is tuned yet, so the first task starts cold.
+    assert all(has_split(record) for record in tune(MatmulModule, _schedule_matmul, "Matmul"))
+    # The new task's own design space does not split, the split loops come from the matmul
+    # trace transplanted onto its anchor block by ScheduleUsingAnchorTrace.
+    # The warm-start round measures that single trace, then one search round follows.
+    records = tune(MatmulReluModule, lambda sch: None, "MatmulRelu")
+    assert len(records) == 1 + num_trials_per_iter
+    assert sum(has_split(record) for record in records) == 1
+
+
 if __name__ == "__main__":
     test_meta_schedule_task_scheduler_single()
     test_meta_schedule_task_scheduler_multiple()
@@ -444,3 +527,5 @@ if __name__ == "__main__":
     test_meta_schedule_task_scheduler_override_next_task_id_only()
     test_meta_schedule_task_scheduler_multiple_gradient_based()
     test_meta_schedule_task_scheduler_gradient_based_with_null_search_strategy()
+    test_meta_schedule_task_scheduler_convergence_aware()
+    test_meta_schedule_task_scheduler_convergence_aware_warm_start()
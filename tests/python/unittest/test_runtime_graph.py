@@ -20,6 +20,7 @@ import tvm.testing
 from tvm import te, runtime
 import numpy as np
 import json
+import pytest
 from tvm import rpc
 from tvm import relay
 from tvm.contrib import utils, graph_executor
@@ -139,6 +140,77 @@ def test_load_unexpected_params():
     rt_mod.load_params(runtime.save_param_dict(new_params))
 
 
+def test_binary_graph():
+    x = relay.var("x", shape=(1, 10))
+    y = relay.var("y", shape=(1, 10))
+    mod = tvm.IRModule.from_expr(relay.Function([x, y], relay.nn.relu(relay.add(x, y))))
+    graph_module = relay.build(mod, target="llvm")
+    graph_json = graph_module.get_graph_json()
+    graph_binary = graph_executor.graph_json_to_binary(graph_json)
+
+    x_np = np.random.uniform(-1, 1, size=(1, 10)).astype("float32")
+    y_np = np.random.uniform(-1, 1, size=(1, 10)).astype("float32")
+    outputs = []
+    for graph in [graph_json, graph_binary, bytes(graph_binary)]:
+        rt_mod = graph_executor.create(graph, graph_module.get_lib(), tvm.cpu(0))
+        assert rt_mod.get_input_index("y") == 1
+        rt_mod.run(x=x_np, y=y_np)
+        outputs.append(rt_mod.get_output(0).numpy())
+    np.testing.assert_equal(outputs[0], np.maximum(x_np + y_np, 0))
+    np.testing.assert_equal(outputs[1], outputs[0])
+    np.testing.assert_equal(outputs[2], outputs[0])
+
+
+def test_binary_graph_malformed():
+    x = relay.var("x", shape=(1, 10))
+    y = relay.var("y", shape=(1, 10))
+    mod = tvm.IRModule.from_expr(relay.Function([x, y], relay.nn.relu(relay.add(x, y))))
+    graph_module = relay.build(mod, target="llvm")
+
+    def corrupt_row_ptr(graph):
+        graph["node_row_ptr"][1] += 1
+
+    def corrupt_output_entry(graph):
+        graph["heads"][0][1] = 1
+
+    def corrupt_storage_id(graph):
+        graph["attrs"]["storage_id"][1].pop()
+
+    def corrupt_shape(graph):
+        graph["attrs"]["shape"][1].pop()
+
+    # The JSON reader does not validate the graph, so the binary graphs are malformed as well.
+    for corrupt in [corrupt_row_ptr, corrupt_output_entry, corrupt_storage_id, corrupt_shape]:
+        graph = json.loads(graph_module.get_graph_json())
+        corrupt(graph)
+        graph_binary = graph_executor.graph_json_to_binary(json.dumps(graph))
+        with pytest.raises(tvm.TVMError, match="Invalid binary graph"):
+            graph_executor.create(graph_binary, graph_module.get_lib(), tvm.cpu(0))
+
+
+def test_clone():
+    x = relay.var("x", shape=(1, 10))
+    w = relay.var("w", shape=(10, 10))
+    mod = tvm.IRModule.from_expr(relay.Function([x, w], relay.nn.dense(x, w)))
+    w_np = np.random.uniform(-1, 1, size=(10, 10)).astype("float32")
+    graph_module = relay.build(mod, target="llvm", params={"w": w_np})
+
+    # The factory sets the parameters, so they must be shared without load_params.
+    rt_mod = graph_executor.GraphModule(graph_module["default"](tvm.cpu(0)))
+    clones = [rt_mod.clone() for _ in range(4)]
+    assert graph_module.get_params()
+    for name in graph_module.get_params():
+        # The parameters are shared rather than copied.
+        data = rt_mod.get_input(name).handle.contents.data
+        for clone in clones:
+            assert clone.get_input(name).handle.contents.data == data
+
+    for clone in [rt_mod] + clones:
+        x_np = np.random.uniform(-1, 1, size=(1, 10)).astype("float32")
+        clone.run(x=x_np)
+        tvm.testing.assert_allclose(clone.get_output(0).numpy(), x_np @ w_np.T, rtol=1e-5)
+
+
 def test_save_load_file():
     p = np.random.randn(10)
     params = {"x": p}
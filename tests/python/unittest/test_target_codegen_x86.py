@@ -107,5 +107,45 @@ def test_fp16_fp32_conversions(feature_string):
     np.testing.assert_allclose(out.asnumpy(), expected, rtol=1e-3)
 
 
+@tvm.testing.requires_llvm
+@pytest.mark.skipif(llvm_version < 12, reason=f"Requires LLVM 12+, got {llvm_version}")
+def test_amx_tile_config():
+    from tvm.tir.tensor_intrin.x86 import AMX_DOT_16x16x64_INTRIN
+
+    X = te.placeholder((128, 128), name="X", dtype="uint8")
+    W = te.placeholder((128, 128), name="W", dtype="int8")
+    k = te.reduce_axis((0, 128), name="k")
+    C = te.compute(
+        (128, 128),
+        lambda i, j: te.sum(X[i, k].astype("int32") * W[j, k].astype("int32"), axis=k),
+        name="compute",
+    )
+    sch = tvm.tir.Schedule(te.create_prim_func([X, W, C]))
+    block = sch.get_block("compute")
+    sch.transform_layout(block, "W", lambda i, j: [i // 16, j // 4, i % 16, j % 4])
+    i, j, k = sch.get_loops(block)
+    io, ii = sch.split(i, factors=[None, 16])
+    jo, ji = sch.split(j, factors=[None, 16])
+    ko, ki = sch.split(k, factors=[None, 64])
+    sch.reorder(io, jo, ko, ii, ji, ki)
+    sch.decompose_reduction(block, ko)
+    sch.tensorize(ii, AMX_DOT_16x16x64_INTRIN)
+    sch.parallel(io)
+
+    f = tvm.build(sch.mod, target="llvm -mtriple=x86_64-linux-gnu -mcpu=sapphirerapids")
+    assembly = f.get_source("asm")
+    # Each parallel task loads the tile configuration before using the tiles, and releases it
+    # after the last use.
+    tile_instr = r"^\s+(ldtilecfg|tilerelease|tileloadd|tdpbusd|tilestored)\b"
+    tile_instrs = re.findall(tile_instr, assembly, re.M)
+    assert tile_instrs.count("ldtilecfg") == 1
+    assert tile_instrs.count("tilerelease") == 1
+    assert tile_instrs[0] == "ldtilecfg"
+    assert tile_instrs[-1] == "tilerelease"
+    assert "tdpbusd" in tile_instrs
+    # The kernel requests the permission to use the tile data through the runtime.
+    assert "runtime.amx_init" in f.get_source("ll")
+
+
 if __name__ == "__main__":
     test_fp16_to_fp32()
@@ -1561,5 +1561,59 @@ def test_async_nested_pipeline_mma_gemm_ideal_annotation():
     build_and_run(sch)
 
 
+def gen_cpu_tiled_copy(prefetch_distance):
+    annotations = {"software_pipeline_stage": [0, 1], "software_pipeline_order": [0, 1]}
+    if prefetch_distance:
+        annotations["software_pipeline_prefetch"] = prefetch_distance
+
+    @T.prim_func
+    def cpu_tiled_copy(A: T.Buffer((16, 64), "float32"), C: T.Buffer((16, 64), "float32")):
+        T.func_attr({"global_symbol": "main", "tir.noalias": True})
+        for i in T.serial(0, 16, annotations=annotations):
+            with T.block():
+                T.reads(A[i, 0:64])
+                T.writes(C[i, 0:64])
+                B = T.alloc_buffer((64,), dtype="float32")
+                for j in range(64):
+                    with T.block():
+                        T.reads(A[i, j])
+                        T.writes(B[j])
+                        B[j] = A[i, j]
+                for j in range(64):
+                    with T.block():
+                        T.reads(B[j])
+                        T.writes(C[i, j])
+                        C[i, j] = B[j] + T.float32(1)
+
+    return cpu_tiled_copy
+
+
+def test_cpu_pipeline_prefetch():
+    def _count_prefetches(func):
+        mod = tvm.IRModule.from_expr(func)
+        mod = tvm.tir.transform.InjectSoftwarePipeline()(mod)
+        calls = []
+
+        def _visit(node):
+            if isinstance(node, tvm.tir.Call) and node.op.same_as(tvm.ir.Op.get("tir.prefetch")):
+                calls.append(node)
+
+        tvm.tir.stmt_functor.post_order_visit(mod["main"].body, _visit)
+        return mod, calls
+
+    _, calls = _count_prefetches(gen_cpu_tiled_copy(0))
+    assert not calls
+    mod, calls = _count_prefetches(gen_cpu_tiled_copy(2))
+    # A row of 64 float32 spans 4 cache lines, prefetched by one loop in the steady state.
+    assert len(calls) == 1
+    assert "software_pipeline_prefetch" not in mod.script()
+
+    a_np = np.random.uniform(size=(16, 64)).astype("float32")
+    a = tvm.nd.array(a_np)
+    c = tvm.nd.array(np.zeros((16, 64), dtype="float32"))
+    tvm.build(gen_cpu_tiled_copy(2), target="llvm")(a, c)
+    tvm.testing.assert_allclose(c.numpy(), a_np + 1)
+
+
 if __name__ == "__main__":
     tvm.testing.main()
@@ -0,0 +1,139 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+import tvm
+import tvm.testing
+from tvm.script import tir as T
+
+
+def _apply(func, distance):
+    mod = tvm.IRModule.from_expr(func)
+    with tvm.transform.PassContext(config={"tir.InjectSoftwarePrefetch": {"distance": distance}}):
+        return tvm.tir.transform.InjectSoftwarePrefetch()(mod)["main"]
+
+
+def _prefetches(loop):
+    body = loop.body
+    stmts = body.seq if isinstance(body, tvm.tir.SeqStmt) else [body]
+    return [
+        stmt
+        for stmt in stmts
+        if isinstance(stmt, tvm.tir.Evaluate)
+        and isinstance(stmt.value, tvm.tir.Call)
+        and stmt.value.op.same_as(tvm.ir.Op.get("tir.prefetch"))
+    ]
+
+
+def test_indirect_load():
+    @T.prim_func
+    def func(
+        A: T.Buffer((4096,), "float32"),
+        B: T.Buffer((128,), "int32"),
+        C: T.Buffer((128,), "float32"),
+    ):
+        for i in range(128):
+            C[i] = A[B[i]]
+
+    loop = _apply(func, 8).body
+    (prefetch,) = _prefetches(loop)
+    load = prefetch.value.args[0].args[0]
+    assert load.buffer.same_as(func.buffer_map[func.params[0]])
+    tvm.ir.assert_structural_equal(load.indices[0].indices[0], T.min(loop.loop_var + 8, 127))
+
+
+def test_gather():
+    @T.prim_func
+    def func(
+        A: T.Buffer((65536,), "float32"),
+        B: T.Buffer((128,), "int32"),
+        C: T.Buffer((8192,), "float32"),
+    ):
+        for i in range(128):
+            for j in range(64):
+                C[i * 64 + j] = A[B[i] * 64 + j]
+
+    outer = _apply(func, 8).body
+    # The rows are walked sequentially, so only the start of the row gathered ahead is prefetched
+    (prefetch,) = _prefetches(outer)
+    load = prefetch.value.args[0].args[0]
+    assert load.buffer.same_as(func.buffer_map[func.params[0]])
+    B = func.buffer_map[func.params[1]]
+    row = tvm.tir.BufferLoad(B, [T.min(outer.loop_var + 8, 127)])
+    tvm.ir.assert_structural_equal(load.indices[0], row * 64)
+    inner = outer.body[-1]
+    assert isinstance(inner, tvm.tir.For)
+    assert not _prefetches(inner)
+
+
+def test_strided_load():
+    @T.prim_func
+    def func(A: T.Buffer((8192,), "float32"), C: T.Buffer((128,), "float32")):
+        for i in range(128):
+            C[i] = A[i * 64] + A[i]
+
+    loop = _apply(func, 4).body
+    (prefetch,) = _prefetches(loop)
+    load = prefetch.value.args[0].args[0]
+    tvm.ir.assert_structural_equal(load.indices[0], T.min(loop.loop_var + 4, 127) * 64)
+
+
+def test_disabled():
+    @T.prim_func
+    def func(
+        A: T.Buffer((4096,), "float32"),
+        B: T.Buffer((128,), "int32"),
+        C: T.Buffer((128,), "float32"),
+    ):
+        for i in range(128):
+            C[i] = A[B[i]]
+
+    assert not _prefetches(_apply(func, 0).body)
+
+
+def test_pragma_distance():
+    @T.prim_func
+    def func(
+        A: T.Buffer((4096,), "float32"),
+        B: T.Buffer((128,), "int32"),
+        C: T.Buffer((128,), "float32"),
+    ):
+        with T.attr(0, "pragma_software_prefetch", 16):
+            for i in range(128):
+                C[i] = A[B[i]]
+
+    loop = _apply(func, 0).body
+    assert isinstance(loop, tvm.tir.For)
+    (prefetch,) = _prefetches(loop)
+    load = prefetch.value.args[0].args[0]
+    tvm.ir.assert_structural_equal(load.indices[0].indices[0], T.min(loop.loop_var + 16, 127))
+
+
+def test_guarded_load():
+    @T.prim_func
+    def func(
+        A: T.Buffer((4096,), "float32"),
+        B: T.Buffer((128,), "int32"),
+        C: T.Buffer((128,), "float32"),
+    ):
+        for i in range(128):
+            if B[i] >= 0:
+                C[i] = A[B[i]]
+
+    assert not _prefetches(_apply(func, 8).body)
+
+
+if __name__ == "__main__":
+    tvm.testing.main()
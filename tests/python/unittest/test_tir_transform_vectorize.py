@@ -14,7 +14,10 @@
 # KIND, either express or implied.  See the License for the
 # specific language governing permissions and limitations
 # under the License.
+import numpy as np
+
 import tvm
+import tvm.testing
 from tvm import te
 
 
@@ -95,6 +98,68 @@ def test_vectorize_with_if_cond_int64():
     f = tvm.build(s, [A, B], "llvm")
 
 
+def test_vectorize_with_if_masked_tail():
+    n = te.var("n")
+    ib = tvm.tir.ir_builder.create()
+    A = ib.pointer("float32", name="A")
+    B = ib.pointer("float32", name="B")
+    with ib.for_range(0, 4, kind="vectorize") as i:
+        with ib.if_scope(i < n):
+            A[i] = B[i] + 1
+    stmt = ib.get()
+
+    mod = tvm.IRModule.from_expr(tvm.tir.PrimFunc([A, B, n], stmt))
+    with tvm.transform.PassContext(config={"tir.vectorize_masked_tail": True}):
+        stmt = tvm.tir.transform.VectorizeLoop()(mod)["main"].body
+
+    assert isinstance(stmt, tvm.tir.Evaluate)
+    assert stmt.value.op.same_as(tvm.ir.Op.get("tir.masked_store"))
+    value = stmt.value.args[1]
+    assert value.dtype == "float32x4"
+    assert value.a.op.same_as(tvm.ir.Op.get("tir.masked_load"))
+
+
+def test_vectorize_masked_tail_build():
+    m = 10
+    A = te.placeholder((m,), name="A")
+    B = te.compute((m,), lambda i: A[i] * 2, name="B")
+    s = te.create_schedule(B.op)
+    _, xi = s[B].split(B.op.axis[0], factor=4)
+    s[B].vectorize(xi)
+    with tvm.transform.PassContext(config={"tir.vectorize_masked_tail": True}):
+        f = tvm.build(s, [A, B], "llvm")
+    assert "llvm.masked.store" in f.get_source("ll")
+
+    dev = tvm.cpu()
+    a = tvm.nd.array(np.random.uniform(size=m).astype(A.dtype), dev)
+    b = tvm.nd.array(np.zeros(m, dtype=B.dtype), dev)
+    f(a, b)
+    tvm.testing.assert_allclose(b.numpy(), a.numpy() * 2)
+
+
+def test_vectorize_masked_tail_int_div():
+    m = 10
+    A = te.placeholder((m,), name="A", dtype="int32")
+    B = te.placeholder((m,), name="B", dtype="int32")
+    C = te.compute((m,), lambda i: tvm.tir.floordiv(A[i], B[i]), name="C")
+    s = te.create_schedule(C.op)
+    _, xi = s[C].split(C.op.axis[0], factor=4)
+    s[C].vectorize(xi)
+    with tvm.transform.PassContext(config={"tir.vectorize_masked_tail": True}):
+        # The disabled lanes of B may hold zeros, so the tail must stay scalar
+        f = tvm.build(s, [A, B, C], "llvm")
+    assert "llvm.masked.store" not in f.get_source("ll")
+
+    dev = tvm.cpu()
+    a_np = np.random.randint(-100, 100, size=m).astype(A.dtype)
+    b_np = np.random.randint(1, 10, size=m).astype(B.dtype)
+    a = tvm.nd.array(a_np, dev)
+    b = tvm.nd.array(b_np, dev)
+    c = tvm.nd.array(np.zeros(m, dtype=C.dtype), dev)
+    f(a, b, c)
+    tvm.testing.assert_allclose(c.numpy(), a_np // b_np)
+
+
 def test_vectorize_let():
     v = tvm.tir.Var("v", "float32")
     ib = tvm.tir.ir_builder.create()
@@ -229,6 +294,9 @@ def test_vectorize_dtype_mismatch():
 if __name__ == "__main__":
     test_vectorize_vector()
     test_vectorize_with_if()
+    test_vectorize_with_if_masked_tail()
+    test_vectorize_masked_tail_build()
+    test_vectorize_masked_tail_int_div()
     test_vectorize_loop()
     test_vectorize_if_then_else()
     test_vectorize_with_le_cond()
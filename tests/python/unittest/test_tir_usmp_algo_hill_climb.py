@@ -400,5 +400,36 @@ def run_intervals(intervals, tolerance=0):
     return result
 
 
+def test_restarts_and_time_budget():
+    """Tests that restarts never give a larger plan and a time budget still gives a valid plan"""
+    random.seed(1)
+    intervals = list(generate_range(32))
+    pools = [WorkspacePoolInfo("default", [])]
+    buffers = [BufferInfo(str(i), size, pools) for i, (_, _, size) in enumerate(intervals)]
+    for i, (i_start, i_stop, _) in enumerate(intervals):
+        buffers[i].set_conflicts(
+            [
+                buffers[j]
+                for j, (j_start, j_stop, _) in enumerate(intervals)
+                if i != j and max(i_start, j_start) <= min(i_stop, j_stop)
+            ]
+        )
+
+    def _plan_size(buffer_pool_allocations):
+        _verify_all_conflicts(buffer_pool_allocations)
+        return max(
+            pool_allocation.byte_offset.value + buffer_info.size_bytes.value
+            for buffer_info, pool_allocation in buffer_pool_allocations.items()
+        )
+
+    fusmp_algo = tvm.get_global_func("tir.usmp.algo.hill_climb")
+    # memory pressure of 0 makes every restart run all of its attempts
+    default_size = _plan_size(fusmp_algo(buffers, 0))
+    with tvm.transform.PassContext(config={"tir.usmp.hill_climb.num_restarts": 4}):
+        assert _plan_size(fusmp_algo(buffers, 0)) <= default_size
+    with tvm.transform.PassContext(config={"tir.usmp.hill_climb.time_budget_ms": 1}):
+        _plan_size(fusmp_algo(buffers, 0))
+
+
 if __name__ == "__main__":
     tvm.testing.main()
@@ -61,6 +61,15 @@ int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, int num_ta
   return 0;
 }
 
+int TVMBackendParallelDispatch(FTVMParallelLambda flambda, void* cdata, int num_task) {
+  TVMParallelGroupEnv env;
+  env.num_task = 1;
+  for (int task_id = 0; task_id < num_task; ++task_id) {
+    if (flambda(task_id, &env, cdata) != 0) return -1;
+  }
+  return 0;
+}
+
 int TVMBackendParallelBarrier(int task_id, TVMParallelGroupEnv* penv) { return 0; }
 
 // --- Environment PackedFuncs for testing ---